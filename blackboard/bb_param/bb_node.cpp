@@ -11,6 +11,8 @@
 
 #include "bb_node.h"
 
+#include "../../compat/object.h"
+
 Variant BBNode::get_value(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, const Variant &p_default) {
 	ERR_FAIL_NULL_V_MSG(p_scene_root, Variant(), "BBNode: get_value() failed - scene_root is null.");
 	ERR_FAIL_COND_V_MSG(p_blackboard.is_null(), Variant(), "BBNode: get_value() failed - blackboard is null.");
@@ -21,13 +23,50 @@ Variant BBNode::get_value(Node *p_scene_root, const Ref<Blackboard> &p_blackboar
 	} else {
 		val = p_blackboard->get_var(get_variable(), p_default);
 	}
+	return _resolve_node(p_scene_root, val, p_default);
+}
+
+Variant BBNode::get_value_by_handle(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle, const Variant &p_default) {
+	ERR_FAIL_NULL_V_MSG(p_scene_root, Variant(), "BBNode: get_value() failed - scene_root is null.");
+	ERR_FAIL_COND_V_MSG(p_blackboard.is_null(), Variant(), "BBNode: get_value() failed - blackboard is null.");
+
+	Variant val;
+	if (get_value_source() == SAVED_VALUE) {
+		val = get_saved_value();
+	} else {
+		val = _get_var_by_handle(p_blackboard, r_handle, p_default);
+	}
+	return _resolve_node_cached(p_scene_root, val, r_handle, p_default);
+}
+
+Variant BBNode::_resolve_node_cached(Node *p_scene_root, const Variant &p_value, BBParamHandle &r_handle, const Variant &p_default) const {
+	if (p_value.get_type() != Variant::NODE_PATH) {
+		r_handle.node_id = ObjectID();
+		return _resolve_node(p_scene_root, p_value, p_default);
+	}
+
+	const NodePath path = p_value;
+	if (r_handle.node_id != ObjectID() && r_handle.node_path == path) {
+		// * Cached node is reused while it's alive and stays in the tree with the scene root.
+		Node *node = Object::cast_to<Node>(OBJECT_DB_GET_INSTANCE(r_handle.node_id));
+		if (likely(node && node->is_inside_tree() == p_scene_root->is_inside_tree())) {
+			return node;
+		}
+	}
+
+	Node *node = p_scene_root->get_node_or_null(path);
+	r_handle.node_id = node ? ObjectID(node->get_instance_id()) : ObjectID();
+	r_handle.node_path = path;
+	return node;
+}
 
-	if (val.get_type() == Variant::NODE_PATH) {
-		return p_scene_root->get_node_or_null(val);
-	} else if (val.get_type() == Variant::OBJECT || val.get_type() == Variant::NIL) {
-		return val;
+Variant BBNode::_resolve_node(Node *p_scene_root, const Variant &p_value, const Variant &p_default) const {
+	if (p_value.get_type() == Variant::NODE_PATH) {
+		return p_scene_root->get_node_or_null(p_value);
+	} else if (p_value.get_type() == Variant::OBJECT || p_value.get_type() == Variant::NIL) {
+		return p_value;
 	} else {
-		WARN_PRINT("BBNode: Unexpected variant type: " + Variant::get_type_name(val.get_type()) + ". Returning default value.");
+		WARN_PRINT("BBNode: Unexpected variant type: " + Variant::get_type_name(p_value.get_type()) + ". Returning default value.");
 		return p_default;
 	}
 }
@@ -17,12 +17,17 @@
 class BBNode : public BBParam {
 	GDCLASS(BBNode, BBParam);
 
+private:
+	Variant _resolve_node(Node *p_scene_root, const Variant &p_value, const Variant &p_default) const;
+	Variant _resolve_node_cached(Node *p_scene_root, const Variant &p_value, BBParamHandle &r_handle, const Variant &p_default) const;
+
 protected:
 	static void _bind_methods() {}
 
 public:
 	virtual Variant::Type get_type() const override { return Variant::NODE_PATH; }
 	virtual Variant get_value(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, const Variant &p_default = Variant()) override;
+	virtual Variant get_value_by_handle(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle, const Variant &p_default = Variant()) override;
 };
 
 #endif // BB_NODE_H
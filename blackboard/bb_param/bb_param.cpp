@@ -73,16 +73,55 @@ Variant BBParam::get_value(Node *p_scene_root, const Ref<Blackboard> &p_blackboa
 	ERR_FAIL_COND_V(!p_blackboard.is_valid(), p_default);
 
 	if (value_source == SAVED_VALUE) {
-		if (saved_value == Variant()) {
-			_assign_default_value();
-		}
-		return saved_value;
+		// Not assigned here: params may be shared between instances, and reads shouldn't write to them.
+		return saved_value == Variant() ? VARIANT_DEFAULT(get_type()) : saved_value;
 	} else {
 		ERR_FAIL_COND_V_MSG(!p_blackboard->has_var(variable), p_default, vformat("BBParam: Blackboard variable \"%s\" doesn't exist.", variable));
 		return p_blackboard->get_var(variable, p_default);
 	}
 }
 
+BBParamHandle BBParam::resolve(const Ref<Blackboard> &p_blackboard) const {
+	BBParamHandle handle;
+	if (value_source == BLACKBOARD_VAR && p_blackboard.is_valid()) {
+		handle.var = p_blackboard->resolve_var(variable);
+	}
+	return handle;
+}
+
+Variant BBParam::get_value_by_handle(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle, const Variant &p_default) {
+	ERR_FAIL_COND_V(!p_blackboard.is_valid(), p_default);
+
+	if (value_source == SAVED_VALUE) {
+		// Not assigned here: params may be shared between instances, and reads shouldn't write to them.
+		return saved_value == Variant() ? VARIANT_DEFAULT(get_type()) : saved_value;
+	} else {
+		return _get_var_by_handle(p_blackboard, r_handle, p_default);
+	}
+}
+
+Variant::Type BBParam::get_declared_type(const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle) const {
+	if (value_source == SAVED_VALUE) {
+		return saved_value.get_type() == Variant::NIL ? get_type() : saved_value.get_type();
+	}
+	if (r_handle.var.name != variable) {
+		r_handle.var.reset(variable);
+	}
+	if (p_blackboard.is_valid() && p_blackboard->has_var_by_handle(r_handle.var)) {
+		return r_handle.var.var.get_type();
+	}
+	return Variant::NIL;
+}
+
+Variant BBParam::_get_var_by_handle(const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle, const Variant &p_default) const {
+	if (unlikely(r_handle.var.name != variable)) {
+		// Variable was changed after the handle was resolved.
+		r_handle.var.reset(variable);
+	}
+	ERR_FAIL_COND_V_MSG(!p_blackboard->has_var_by_handle(r_handle.var), p_default, vformat("BBParam: Blackboard variable \"%s\" doesn't exist.", variable));
+	return r_handle.var.var.get_value();
+}
+
 void BBParam::_assign_default_value() {
 	saved_value = VARIANT_DEFAULT(get_type());
 }
@@ -25,6 +25,16 @@
 #include <godot_cpp/classes/resource.hpp>
 #endif // LIMBOAI_GDEXTENSION
 
+// Per-task state for reading a BBParam, resolved in the task's _setup().
+// BBParam resources may be shared between tree instances (see BTTask::set_share_bb_params()), so the handle is kept by the task.
+struct BBParamHandle {
+	BBVarHandle var;
+
+	// * Node resolved from node_path (used by BBNode).
+	ObjectID node_id;
+	NodePath node_path;
+};
+
 class BBParam : public Resource {
 	GDCLASS(BBParam, Resource);
 
@@ -47,6 +57,7 @@ protected:
 	static void _bind_methods();
 
 	void _assign_default_value();
+	Variant _get_var_by_handle(const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle, const Variant &p_default) const;
 
 	void _get_property_list(List<PropertyInfo> *p_list) const;
 
@@ -70,6 +81,12 @@ public:
 	virtual Variant::Type get_variable_expected_type() const { return get_type(); }
 	virtual Variant get_value(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, const Variant &p_default = Variant());
 
+	// * Handle-based access: same result as get_value(), without looking up the variable by name on each call.
+	BBParamHandle resolve(const Ref<Blackboard> &p_blackboard) const;
+	virtual Variant get_value_by_handle(Node *p_scene_root, const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle, const Variant &p_default = Variant());
+	// Returns the type declared for the value, or NIL if it isn't known in advance.
+	Variant::Type get_declared_type(const Ref<Blackboard> &p_blackboard, BBParamHandle &r_handle) const;
+
 	BBParam();
 };
 
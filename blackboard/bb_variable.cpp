@@ -13,50 +13,193 @@
 
 #include "../compat/object.h"
 #include "../compat/variant.h"
+#include "../util/limbo_string_names.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/object/class_db.h"
+#include "core/object/script_language.h"
+
+namespace {
+
+// Returns the native getter or setter bound to a property, or nullptr if the property has none.
+MethodBind *_find_property_accessor(const Object *p_object, const StringName &p_property, bool p_setter) {
+	StringName class_name = p_object->get_class_name();
+	StringName method = p_setter ? ClassDB::get_property_setter(class_name, p_property) : ClassDB::get_property_getter(class_name, p_property);
+	if (method == StringName()) {
+		return nullptr;
+	}
+	MethodBind *mb = ClassDB::get_method(class_name, method);
+	// Indexed properties take an extra argument - these are accessed through Object::get/set.
+	if (mb == nullptr || mb->get_argument_count() != (p_setter ? 1 : 0)) {
+		return nullptr;
+	}
+	return mb;
+}
+
+// Scripts can intercept any property with _get/_set, which Object::get/set call before the native accessors.
+_FORCE_INLINE_ bool _is_accessor_usable(const Object *p_object, bool p_setter) {
+	ScriptInstance *si = p_object->get_script_instance();
+	return si == nullptr || !si->has_method(p_setter ? LW_NAME(_set) : LW_NAME(_get));
+}
+
+} // namespace
+
+#endif // LIMBOAI_MODULE
+
+namespace {
+
+// Returns a new packed array that shares the copy-on-write buffer of p_value.
+// Unlike Variant copies, changes to it are not visible through p_value.
+Variant _share_packed_array(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::PACKED_BYTE_ARRAY: {
+			return PackedByteArray(p_value);
+		}
+		case Variant::PACKED_INT32_ARRAY: {
+			return PackedInt32Array(p_value);
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			return PackedInt64Array(p_value);
+		}
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			return PackedFloat32Array(p_value);
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			return PackedFloat64Array(p_value);
+		}
+		case Variant::PACKED_STRING_ARRAY: {
+			return PackedStringArray(p_value);
+		}
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			return PackedVector2Array(p_value);
+		}
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			return PackedVector3Array(p_value);
+		}
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			return PackedVector4Array(p_value);
+		}
+		case Variant::PACKED_COLOR_ARRAY: {
+			return PackedColorArray(p_value);
+		}
+		default: {
+			return p_value.duplicate(true);
+		}
+	}
+}
+
+void _make_read_only_recursive(const Variant &p_value) {
+	if (p_value.get_type() == Variant::ARRAY) {
+		Array arr = p_value;
+		for (int i = 0; i < arr.size(); i++) {
+			_make_read_only_recursive(arr[i]);
+		}
+		arr.make_read_only();
+	} else if (p_value.get_type() == Variant::DICTIONARY) {
+		Dictionary dict = p_value;
+		Array values = dict.values();
+		for (int i = 0; i < values.size(); i++) {
+			_make_read_only_recursive(values[i]);
+		}
+		dict.make_read_only();
+	}
+}
+
+} // namespace
 
 void BBVariable::unref() {
 	if (data && data->refcount.unref()) {
+		if (data->extra && data->extra->refcount.unref()) {
+			memdelete(data->extra);
+		}
 		memdelete(data);
 	}
 	data = nullptr;
 }
 
+BBVariable::Extra *BBVariable::_make_extra_unique() {
+	Extra *extra = data->extra;
+	if (extra && extra->refcount.get() == 1) {
+		return extra;
+	}
+	Extra *unique = memnew(Extra);
+	unique->refcount.init();
+	if (extra) {
+		unique->hint = extra->hint;
+		unique->hint_string = extra->hint_string;
+		unique->binding_path = extra->binding_path;
+		unique->bound_object = extra->bound_object;
+		unique->bound_property = extra->bound_property;
+#ifdef LIMBOAI_MODULE
+		unique->getter = extra->getter;
+		unique->setter = extra->setter;
+#endif
+		if (extra->refcount.unref()) {
+			memdelete(extra);
+		}
+	}
+	data->extra = unique;
+	return unique;
+}
+
 void BBVariable::set_value(const Variant &p_value) {
 	data->value = p_value; // Setting value even when bound as a fallback in case the binding fails.
+	data->value_shared = false;
+	data->shared_value = Variant();
 	data->value_changed = true;
+	data->version++;
 
 	if (is_bound()) {
-		Object *obj = OBJECT_DB_GET_INSTANCE(data->bound_object);
+		Object *obj = OBJECT_DB_GET_INSTANCE(data->extra->bound_object);
 		ERR_FAIL_COND_MSG(!obj, "Blackboard: Failed to get bound object.");
 #ifdef LIMBOAI_MODULE
+		if (data->extra->setter && _is_accessor_usable(obj, true)) {
+			const Variant *argptr = &p_value;
+			Callable::CallError ce;
+			data->extra->setter->call(obj, &argptr, 1, ce);
+			ERR_FAIL_COND_MSG(ce.error != Callable::CallError::CALL_OK, vformat("Blackboard: Failed to set bound property `%s` on %s", data->extra->bound_property, obj));
+			return;
+		}
 		bool r_valid;
-		obj->set(data->bound_property, p_value, &r_valid);
-		ERR_FAIL_COND_MSG(!r_valid, vformat("Blackboard: Failed to set bound property `%s` on %s", data->bound_property, obj));
+		obj->set(data->extra->bound_property, p_value, &r_valid);
+		ERR_FAIL_COND_MSG(!r_valid, vformat("Blackboard: Failed to set bound property `%s` on %s", data->extra->bound_property, obj));
 #elif LIMBOAI_GDEXTENSION
-		obj->set(data->bound_property, p_value);
+		obj->set(data->extra->bound_property, p_value);
 #endif
 	}
 }
 
 Variant BBVariable::get_value() const {
 	if (is_bound()) {
-		Object *obj = OBJECT_DB_GET_INSTANCE(data->bound_object);
+		Object *obj = OBJECT_DB_GET_INSTANCE(data->extra->bound_object);
 		ERR_FAIL_COND_V_MSG(!obj, data->value, "Blackboard: Failed to get bound object.");
 #ifdef LIMBOAI_MODULE
+		if (data->extra->getter && _is_accessor_usable(obj, false)) {
+			Callable::CallError ce;
+			Variant ret = data->extra->getter->call(obj, nullptr, 0, ce);
+			ERR_FAIL_COND_V_MSG(ce.error != Callable::CallError::CALL_OK, data->value, vformat("Blackboard: Failed to get bound property `%s` on %s", data->extra->bound_property, obj));
+			return ret;
+		}
 		bool r_valid;
-		Variant ret = obj->get(data->bound_property, &r_valid);
-		ERR_FAIL_COND_V_MSG(!r_valid, data->value, vformat("Blackboard: Failed to get bound property `%s` on %s", data->bound_property, obj));
+		Variant ret = obj->get(data->extra->bound_property, &r_valid);
+		ERR_FAIL_COND_V_MSG(!r_valid, data->value, vformat("Blackboard: Failed to get bound property `%s` on %s", data->extra->bound_property, obj));
 #elif LIMBOAI_GDEXTENSION
-		Variant ret = obj->get(data->bound_property);
+		Variant ret = obj->get(data->extra->bound_property);
 #endif
 		return ret;
 	}
+	if (unlikely(data->value_shared)) {
+		data->value = data->value.duplicate(true);
+		data->value_shared = false;
+	}
 	return data->value;
 }
 
 void BBVariable::set_type(Variant::Type p_type) {
 	data->type = p_type;
 	data->value = VARIANT_DEFAULT(p_type);
+	data->value_shared = false;
+	data->shared_value = Variant();
 }
 
 Variant::Type BBVariable::get_type() const {
@@ -64,34 +207,72 @@ Variant::Type BBVariable::get_type() const {
 }
 
 void BBVariable::set_hint(PropertyHint p_hint) {
-	data->hint = p_hint;
+	if (!data->extra && p_hint == PROPERTY_HINT_NONE) {
+		return;
+	}
+	_make_extra_unique()->hint = p_hint;
 }
 
 PropertyHint BBVariable::get_hint() const {
-	return data->hint;
+	return data->extra ? data->extra->hint : PROPERTY_HINT_NONE;
 }
 
 void BBVariable::set_hint_string(const String &p_hint_string) {
-	data->hint_string = p_hint_string;
+	if (!data->extra && p_hint_string.is_empty()) {
+		return;
+	}
+	_make_extra_unique()->hint_string = p_hint_string;
 }
 
 String BBVariable::get_hint_string() const {
-	return data->hint_string;
+	return data->extra ? data->extra->hint_string : String();
+}
+
+void BBVariable::set_binding_path(const NodePath &p_binding_path) {
+	if (!data->extra && p_binding_path.is_empty()) {
+		return;
+	}
+	_make_extra_unique()->binding_path = p_binding_path;
 }
 
 BBVariable BBVariable::duplicate(bool p_deep) const {
 	BBVariable var;
-	var.data->hint = data->hint;
-	var.data->hint_string = data->hint_string;
 	var.data->type = data->type;
-	if (p_deep) {
+	if (p_deep && !data->value_shared) {
 		var.data->value = data->value.duplicate(p_deep);
 	} else {
 		var.data->value = data->value;
+		var.data->value_shared = data->value_shared;
+	}
+	if (data->extra && data->extra->refcount.ref()) {
+		var.data->extra = data->extra;
+	}
+	return var;
+}
+
+BBVariable BBVariable::duplicate_deferred(bool p_share_read_only) const {
+	BBVariable var = duplicate(false);
+	switch (data->value.get_type()) {
+		case Variant::ARRAY:
+		case Variant::DICTIONARY: {
+			if (p_share_read_only && !data->value_shared) {
+				// Reads return the shared copy; in-place modification fails until a new value is assigned.
+				if (data->shared_value.get_type() == Variant::NIL) {
+					data->shared_value = data->value.duplicate(true);
+					_make_read_only_recursive(data->shared_value);
+				}
+				var.data->value = data->shared_value;
+				var.data->value_shared = false;
+			} else {
+				var.data->value_shared = true;
+			}
+		} break;
+		default: {
+			if (!data->value_shared) {
+				var.data->value = _share_packed_array(data->value);
+			}
+		} break;
 	}
-	var.data->binding_path = data->binding_path;
-	var.data->bound_object = data->bound_object;
-	var.data->bound_property = data->bound_property;
 	return var;
 }
 
@@ -99,10 +280,13 @@ bool BBVariable::is_same_prop_info(const BBVariable &p_other) const {
 	if (data->type != p_other.data->type) {
 		return false;
 	}
-	if (data->hint != p_other.data->hint) {
+	if (data->extra == p_other.data->extra) {
+		return true;
+	}
+	if (get_hint() != p_other.get_hint()) {
 		return false;
 	}
-	if (data->hint_string != p_other.data->hint_string) {
+	if (get_hint_string() != p_other.get_hint_string()) {
 		return false;
 	}
 	return true;
@@ -110,21 +294,34 @@ bool BBVariable::is_same_prop_info(const BBVariable &p_other) const {
 
 void BBVariable::copy_prop_info(const BBVariable &p_other) {
 	data->type = p_other.data->type;
-	data->hint = p_other.data->hint;
-	data->hint_string = p_other.data->hint_string;
+	set_hint(p_other.get_hint());
+	set_hint_string(p_other.get_hint_string());
 }
 
 void BBVariable::bind(Object *p_object, const StringName &p_property) {
 	ERR_FAIL_NULL_MSG(p_object, "Blackboard: Binding failed - object is null.");
 	ERR_FAIL_COND_MSG(p_property == StringName(), "Blackboard: Binding failed - property name is empty.");
 	ERR_FAIL_COND_MSG(!OBJECT_HAS_PROPERTY(p_object, p_property), vformat("Blackboard: Binding failed - %s has no property `%s`.", p_object, p_property));
-	data->bound_object = p_object->get_instance_id();
-	data->bound_property = p_property;
+	Extra *extra = _make_extra_unique();
+	extra->bound_object = p_object->get_instance_id();
+	extra->bound_property = p_property;
+#ifdef LIMBOAI_MODULE
+	extra->getter = _find_property_accessor(p_object, p_property, false);
+	extra->setter = _find_property_accessor(p_object, p_property, true);
+#endif
 }
 
 void BBVariable::unbind() {
-	data->bound_object = 0;
-	data->bound_property = StringName();
+	if (!is_bound()) {
+		return;
+	}
+	Extra *extra = _make_extra_unique();
+	extra->bound_object = 0;
+	extra->bound_property = StringName();
+#ifdef LIMBOAI_MODULE
+	extra->getter = nullptr;
+	extra->setter = nullptr;
+#endif
 }
 
 bool BBVariable::operator==(const BBVariable &p_var) const {
@@ -136,15 +333,7 @@ bool BBVariable::operator==(const BBVariable &p_var) const {
 		return false;
 	}
 
-	if (data->type != p_var.data->type) {
-		return false;
-	}
-
-	if (data->hint != p_var.data->hint) {
-		return false;
-	}
-
-	if (data->hint_string != p_var.data->hint_string) {
+	if (!is_same_prop_info(p_var)) {
 		return false;
 	}
 
@@ -182,8 +371,8 @@ BBVariable::BBVariable(Variant::Type p_type, PropertyHint p_hint, const String &
 	data->refcount.init();
 
 	set_type(p_type);
-	data->hint = p_hint;
-	data->hint_string = p_hint_string;
+	set_hint(p_hint);
+	set_hint_string(p_hint_string);
 }
 
 BBVariable::~BBVariable() {
@@ -13,7 +13,9 @@
 #define BB_VARIABLE_H
 
 #ifdef LIMBOAI_MODULE
+#include "core/object/method_bind.h"
 #include "core/object/object.h"
+#include "core/variant/variant_internal.h"
 #endif // LIMBOAI_MODULE
 
 #ifdef LIMBOAI_GDEXTENSION
@@ -23,30 +25,99 @@
 using namespace godot;
 #endif // LIMBOAI_GDEXTENSION
 
+// Primitive types with typed access in BBVariable.
+template <typename T>
+struct BBTypeTraits;
+
+#define BB_TYPE_TRAITS(m_type, m_variant_type, m_getter)                                       \
+	template <>                                                                                 \
+	struct BBTypeTraits<m_type> {                                                               \
+		static constexpr Variant::Type TYPE = Variant::m_variant_type;                          \
+		BB_TYPE_TRAITS_PTR(m_type, m_getter)                                                    \
+	};
+
+#ifdef LIMBOAI_MODULE
+#define BB_TYPE_TRAITS_PTR(m_type, m_getter)                                                    \
+	static _FORCE_INLINE_ m_type *ptr(Variant *p_v) { return VariantInternal::m_getter(p_v); } \
+	static _FORCE_INLINE_ const m_type *ptr(const Variant *p_v) { return VariantInternal::m_getter(p_v); }
+#elif LIMBOAI_GDEXTENSION
+#define BB_TYPE_TRAITS_PTR(m_type, m_getter)
+#endif
+
+BB_TYPE_TRAITS(bool, BOOL, get_bool)
+BB_TYPE_TRAITS(int64_t, INT, get_int)
+BB_TYPE_TRAITS(double, FLOAT, get_float)
+BB_TYPE_TRAITS(Vector2, VECTOR2, get_vector2)
+BB_TYPE_TRAITS(Vector3, VECTOR3, get_vector3)
+
+#undef BB_TYPE_TRAITS_PTR
+#undef BB_TYPE_TRAITS
+
 class BBVariable {
 private:
-	struct Data {
-		// Is used to decide if the value needs to be synced in a derived plan.
-		bool value_changed = false;
-
+	// Property info and binding, rarely present on runtime variables.
+	// Shared between duplicates and copied on write.
+	struct Extra {
 		SafeRefCount refcount;
-		Variant value;
-		Variant::Type type = Variant::NIL;
 		PropertyHint hint = PropertyHint::PROPERTY_HINT_NONE;
 		String hint_string;
 
 		NodePath binding_path;
 		uint64_t bound_object = 0;
 		StringName bound_property;
+#ifdef LIMBOAI_MODULE
+		// Native accessors of the bound property, resolved in bind(); nullptr if not available.
+		MethodBind *getter = nullptr;
+		MethodBind *setter = nullptr;
+#endif
+	};
+
+	struct Data {
+		SafeRefCount refcount;
+		// Is used to decide if the value needs to be synced in a derived plan.
+		bool value_changed = false;
+		// Value is shared with other variables; it is duplicated on first access.
+		bool value_shared = false;
+		Variant::Type type = Variant::NIL;
+		uint32_t version = 0; // Incremented on every write.
+		Variant value;
+		Variant shared_value; // Read-only deep copy of the value, handed out by duplicate_deferred(true); nil until needed.
+		Extra *extra = nullptr;
 	};
 
 	Data *data = nullptr;
 	void unref();
+	Extra *_make_extra_unique();
 
 public:
 	void set_value(const Variant &p_value);
 	Variant get_value() const;
 
+	// Typed access for bool, int, float, Vector2 and Vector3 values.
+	// Reads and writes the stored value in place when its type matches, skipping Variant construction.
+	template <typename T>
+	_FORCE_INLINE_ T get_typed() const {
+#ifdef LIMBOAI_MODULE
+		if (likely(!is_bound() && data->value.get_type() == BBTypeTraits<T>::TYPE)) {
+			return *BBTypeTraits<T>::ptr(&data->value);
+		}
+#endif
+		return get_value();
+	}
+
+	template <typename T>
+	_FORCE_INLINE_ void set_typed(const T &p_value) {
+#ifdef LIMBOAI_MODULE
+		if (likely(!is_bound() && data->value.get_type() == BBTypeTraits<T>::TYPE)) {
+			*BBTypeTraits<T>::ptr(&data->value) = p_value;
+			data->value_changed = true;
+			data->version++;
+			return;
+		}
+#endif
+		set_value(p_value);
+	}
+
 	void set_type(Variant::Type p_type);
 	Variant::Type get_type() const;
 
@@ -57,20 +128,30 @@ public:
 	String get_hint_string() const;
 
 	BBVariable duplicate(bool p_deep = false) const;
+	// Like duplicate(true), but arrays and dictionaries are copied on first access,
+	// and packed arrays share their buffer until written to.
+	// With p_share_read_only, arrays and dictionaries are instead shared as a read-only copy until a new value is assigned.
+	BBVariable duplicate_deferred(bool p_share_read_only = false) const;
 
 	_FORCE_INLINE_ bool is_value_changed() const { return data->value_changed; }
+	_FORCE_INLINE_ uint32_t get_version() const { return data->version; }
 	_FORCE_INLINE_ void reset_value_changed() { data->value_changed = false; }
 
+	// Variables share storage when they are copies of each other, e.g., when linked between blackboards.
+	_FORCE_INLINE_ uint64_t get_storage_id() const { return (uint64_t)data; }
+
 	bool is_same_prop_info(const BBVariable &p_other) const;
 	void copy_prop_info(const BBVariable &p_other);
 
 	// * Editor binding methods
-	NodePath get_binding_path() const { return data->binding_path; }
-	void set_binding_path(const NodePath &p_binding_path) { data->binding_path = p_binding_path; }
-	bool has_binding() { return data->binding_path.is_empty(); }
+	NodePath get_binding_path() const { return data->extra ? data->extra->binding_path : NodePath(); }
+	void set_binding_path(const NodePath &p_binding_path);
+	bool has_binding() { return get_binding_path().is_empty(); }
 
 	// * Runtime binding methods
-	_FORCE_INLINE_ bool is_bound() const { return data->bound_object != 0; }
+	_FORCE_INLINE_ bool is_bound() const { return data->extra && data->extra->bound_object != 0; }
+	_FORCE_INLINE_ uint64_t get_bound_object_id() const { return is_bound() ? data->extra->bound_object : 0; }
+	_FORCE_INLINE_ StringName get_bound_property() const { return is_bound() ? data->extra->bound_property : StringName(); }
 	void bind(Object *p_object, const StringName &p_property);
 	void unbind();
 
@@ -10,7 +10,46 @@
  */
 
 #include "blackboard.h"
+#include "../compat/object.h"
 #include "../compat/print.h"
+#include "../compat/resource.h"
+#include "../compat/resource_loader.h"
+#include "../compat/scene_tree.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/io/stream_peer.h"
+#include "core/templates/hash_set.h"
+#include "scene/main/node.h"
+#include "scene/main/window.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/stream_peer_buffer.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
+namespace {
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x5342424C; // "LBBS"
+constexpr uint8_t SNAPSHOT_FORMAT_VERSION = 2;
+
+// Kinds of variable entries in a snapshot.
+enum SnapshotEntryKind : uint8_t {
+	SNAPSHOT_ENTRY_VALUE,
+	SNAPSHOT_ENTRY_NODE, // Node stored by its absolute path.
+	SNAPSHOT_ENTRY_LINK, // Shares storage with a variable stored earlier in the snapshot.
+	SNAPSHOT_ENTRY_BOUND, // Value lives in a bound property; stored as the node path and the property name.
+	SNAPSHOT_ENTRY_RESOURCE, // Resource stored by its file path.
+};
+
+} // namespace
+
+void Blackboard::set_parent(const Ref<Blackboard> &p_blackboard) {
+	parent = p_blackboard;
+	_layout_changed();
+}
 
 Ref<Blackboard> Blackboard::top() const {
 	Ref<Blackboard> bb(this);
@@ -20,36 +59,65 @@ Ref<Blackboard> Blackboard::top() const {
 	return bb;
 }
 
+const BBVarHandle &Blackboard::_resolve_in_parent_scopes(const StringName &p_name) const {
+	HashMap<StringName, BBVarHandle>::Iterator E = scope_cache.find(p_name);
+	if (E) {
+		if (unlikely(!_is_handle_valid(E->value))) {
+			_resolve_handle(E->value);
+		}
+		return E->value;
+	}
+	BBVarHandle handle;
+	handle.name = p_name;
+	_resolve_handle(handle);
+	return scope_cache.insert(p_name, handle)->value;
+}
+
 Variant Blackboard::get_var(const StringName &p_name, const Variant &p_default, bool p_complain) const {
-	if (data.has(p_name)) {
-		return data.get(p_name).get_value();
-	} else if (parent.is_valid()) {
-		return parent->get_var(p_name, p_default, p_complain);
-	} else {
-		if (p_complain) {
-			ERR_PRINT(vformat("Blackboard: Variable \"%s\" not found.", p_name));
+	HashMap<StringName, BBVariable>::ConstIterator E = data.find(p_name);
+	if (E) {
+		return E->value.get_value();
+	}
+	if (parent.is_valid()) {
+		const BBVarHandle &handle = _resolve_in_parent_scopes(p_name);
+		if (handle.found) {
+			return handle.var.get_value();
 		}
-		return p_default;
 	}
+	if (p_complain) {
+		ERR_PRINT(vformat("Blackboard: Variable \"%s\" not found.", p_name));
+	}
+	return p_default;
 }
 
 void Blackboard::set_var(const StringName &p_name, const Variant &p_value) {
-	if (data.has(p_name)) {
+	HashMap<StringName, BBVariable>::Iterator E = data.find(p_name);
+	if (E) {
 		// Not checking type - allowing duck-typing.
-		data[p_name].set_value(p_value);
+		E->value.set_value(p_value);
 	} else {
 		BBVariable var(p_value.get_type());
 		var.set_value(p_value);
 		data.insert(p_name, var);
+		_layout_changed();
 	}
 }
 
 bool Blackboard::has_var(const StringName &p_name) const {
-	return data.has(p_name) || (parent.is_valid() && parent->has_var(p_name));
+	return data.has(p_name) || (parent.is_valid() && _resolve_in_parent_scopes(p_name).found);
 }
 
 void Blackboard::erase_var(const StringName &p_name) {
-	data.erase(p_name);
+	if (data.erase(p_name)) {
+		foreign_links.erase(p_name);
+		_layout_changed();
+	}
+}
+
+void Blackboard::clear() {
+	data.clear();
+	foreign_links.clear();
+	_layout_changed();
 }
 
 TypedArray<StringName> Blackboard::list_vars() const {
@@ -102,24 +170,290 @@ void Blackboard::populate_from_dict(const Dictionary &p_dictionary) {
 	}
 }
 
+PackedByteArray Blackboard::save_snapshot() const {
+	// Scopes are stored from the top of the chain, so links always point to earlier entries.
+	LocalVector<const Blackboard *> chain;
+	for (const Blackboard *bb = this; bb; bb = bb->parent.ptr()) {
+		chain.push_back(bb);
+	}
+	chain.invert();
+
+	Ref<StreamPeerBuffer> stream;
+	stream.instantiate();
+	stream->put_u32(SNAPSHOT_MAGIC);
+	stream->put_u8(SNAPSHOT_FORMAT_VERSION);
+	stream->put_u32(chain.size());
+
+	HashMap<uint64_t, Pair<uint32_t, StringName>> owners; // Storage ID => first scope and variable using it.
+	for (uint32_t scope = 0; scope < chain.size(); scope++) {
+		const Blackboard *bb = chain[scope];
+		stream->put_u32(bb->data.size());
+		for (const KeyValue<StringName, BBVariable> &kv : bb->data) {
+			stream->put_utf8_string(String(kv.key));
+
+			HashMap<uint64_t, Pair<uint32_t, StringName>>::ConstIterator owner = owners.find(kv.value.get_storage_id());
+			if (owner) {
+				stream->put_u8(SNAPSHOT_ENTRY_LINK);
+				stream->put_u32(owner->value.first);
+				stream->put_utf8_string(String(owner->value.second));
+				continue;
+			}
+			owners.insert(kv.value.get_storage_id(), Pair<uint32_t, StringName>(scope, kv.key));
+
+			if (kv.value.is_bound()) {
+				// Bindings to nodes are stored by path; other objects can only be matched against the current binding.
+				Node *node = Object::cast_to<Node>(OBJECT_DB_GET_INSTANCE(kv.value.get_bound_object_id()));
+				stream->put_u8(SNAPSHOT_ENTRY_BOUND);
+				stream->put_utf8_string(node && node->is_inside_tree() ? String(node->get_path()) : String());
+				stream->put_utf8_string(String(kv.value.get_bound_property()));
+				continue;
+			}
+
+			Variant value = kv.value.get_value();
+			if (value.get_type() == Variant::OBJECT) {
+				Node *node = Object::cast_to<Node>(value);
+				if (node && node->is_inside_tree()) {
+					stream->put_u8(SNAPSHOT_ENTRY_NODE);
+					stream->put_utf8_string(String(node->get_path()));
+					continue;
+				}
+				Ref<Resource> res = value;
+				if (res.is_valid() && RESOURCE_IS_EXTERNAL(res)) {
+					stream->put_u8(SNAPSHOT_ENTRY_RESOURCE);
+					stream->put_utf8_string(res->get_path());
+					continue;
+				}
+				Object *obj = value;
+				if (obj != nullptr) {
+					WARN_PRINT(vformat("Blackboard: Variable \"%s\" holds an object that can't be referenced in a snapshot; it is stored as null.", kv.key));
+				}
+				value = Variant();
+			}
+			stream->put_u8(SNAPSHOT_ENTRY_VALUE);
+			stream->put_var(value);
+		}
+	}
+	return stream->get_data_array();
+}
+
+bool Blackboard::_parse_snapshot(const PackedByteArray &p_snapshot, LocalVector<LocalVector<SnapshotEntry>> &r_scopes) const {
+	uint32_t chain_size = 0;
+	for (const Blackboard *bb = this; bb; bb = bb->parent.ptr()) {
+		chain_size++;
+	}
+
+	Ref<StreamPeerBuffer> stream;
+	stream.instantiate();
+	stream->set_data_array(p_snapshot);
+	ERR_FAIL_COND_V_MSG(p_snapshot.size() < 9 || stream->get_u32() != SNAPSHOT_MAGIC, false, "Blackboard: Invalid snapshot data.");
+	ERR_FAIL_COND_V_MSG(stream->get_u8() != SNAPSHOT_FORMAT_VERSION, false, "Blackboard: Unsupported snapshot format version.");
+	uint32_t num_scopes = stream->get_u32();
+	ERR_FAIL_COND_V_MSG(num_scopes != chain_size, false, vformat("Blackboard: Snapshot scope chain doesn't match the blackboard (%d vs %d scopes).", num_scopes, chain_size));
+
+	r_scopes.clear();
+	r_scopes.resize(num_scopes);
+	LocalVector<HashSet<StringName>> owners; // Variables with their own storage, per scope.
+	owners.resize(num_scopes);
+	for (uint32_t scope = 0; scope < num_scopes; scope++) {
+		ERR_FAIL_COND_V_MSG(stream->get_available_bytes() < 4, false, "Blackboard: Snapshot data is truncated.");
+		uint32_t num_vars = stream->get_u32();
+		ERR_FAIL_COND_V_MSG(num_vars > (uint32_t)stream->get_available_bytes(), false, "Blackboard: Snapshot data is corrupted.");
+		for (uint32_t i = 0; i < num_vars; i++) {
+			ERR_FAIL_COND_V_MSG(stream->get_available_bytes() <= 0, false, "Blackboard: Snapshot data is truncated.");
+			SnapshotEntry entry;
+			entry.name = stream->get_utf8_string();
+			entry.kind = stream->get_u8();
+			switch (entry.kind) {
+				case SNAPSHOT_ENTRY_VALUE: {
+					entry.value = stream->get_var();
+				} break;
+				case SNAPSHOT_ENTRY_NODE:
+				case SNAPSHOT_ENTRY_RESOURCE: {
+					entry.path = stream->get_utf8_string();
+				} break;
+				case SNAPSHOT_ENTRY_LINK: {
+					entry.owner_scope = stream->get_u32();
+					entry.target = stream->get_utf8_string();
+					ERR_FAIL_COND_V_MSG(entry.owner_scope > scope || !owners[entry.owner_scope].has(entry.target), false, "Blackboard: Snapshot data is corrupted.");
+				} break;
+				case SNAPSHOT_ENTRY_BOUND: {
+					entry.path = stream->get_utf8_string();
+					entry.target = stream->get_utf8_string();
+				} break;
+				default: {
+					ERR_FAIL_V_MSG(false, "Blackboard: Snapshot data is corrupted.");
+				}
+			}
+			ERR_FAIL_COND_V_MSG(stream->get_position() > p_snapshot.size(), false, "Blackboard: Snapshot data is truncated.");
+			if (entry.kind != SNAPSHOT_ENTRY_LINK) {
+				owners[scope].insert(entry.name);
+			}
+			r_scopes[scope].push_back(entry);
+		}
+	}
+	ERR_FAIL_COND_V_MSG(stream->get_available_bytes() != 0, false, "Blackboard: Snapshot data is corrupted.");
+	return true;
+}
+
+bool Blackboard::is_snapshot_valid(const PackedByteArray &p_snapshot) const {
+	LocalVector<LocalVector<SnapshotEntry>> scopes;
+	return _parse_snapshot(p_snapshot, scopes);
+}
+
+void Blackboard::load_snapshot(const PackedByteArray &p_snapshot) {
+	// The whole snapshot is parsed and validated first, so corrupted data leaves the blackboards untouched.
+	LocalVector<LocalVector<SnapshotEntry>> scopes;
+	if (!_parse_snapshot(p_snapshot, scopes)) {
+		return;
+	}
+
+	LocalVector<Blackboard *> chain;
+	for (Blackboard *bb = this; bb; bb = bb->parent.ptr()) {
+		chain.push_back(bb);
+	}
+	chain.invert();
+
+	Node *scene_root = SCENE_TREE() ? SCENE_TREE()->get_root() : nullptr;
+	HashSet<StringName> restored;
+	HashSet<uint64_t> owner_storages; // Storage of restored variables that don't link to another one.
+	for (uint32_t scope = 0; scope < chain.size(); scope++) {
+		Blackboard *bb = chain[scope];
+		restored.clear();
+		for (const SnapshotEntry &entry : scopes[scope]) {
+			const StringName &name = entry.name;
+			restored.insert(name);
+			switch (entry.kind) {
+				case SNAPSHOT_ENTRY_VALUE: {
+					bb->_restore_own_storage(name, true, owner_storages);
+					bb->set_var(name, entry.value);
+				} break;
+				case SNAPSHOT_ENTRY_NODE: {
+					Node *node = scene_root ? scene_root->get_node_or_null(NodePath(entry.path)) : nullptr;
+					if (node == nullptr) {
+						WARN_PRINT(vformat("Blackboard: Can't restore variable \"%s\" - node not found: %s", name, entry.path));
+					}
+					bb->_restore_own_storage(name, true, owner_storages);
+					bb->set_var(name, node);
+				} break;
+				case SNAPSHOT_ENTRY_RESOURCE: {
+					Ref<Resource> res = RESOURCE_LOAD(entry.path, "");
+					if (res.is_null()) {
+						WARN_PRINT(vformat("Blackboard: Can't restore variable \"%s\" - failed to load resource: %s", name, entry.path));
+					}
+					bb->_restore_own_storage(name, true, owner_storages);
+					bb->set_var(name, res);
+				} break;
+				case SNAPSHOT_ENTRY_LINK: {
+					const BBVariable &owner = chain[entry.owner_scope]->data[entry.target];
+					HashMap<StringName, BBVariable>::Iterator E = bb->data.find(name);
+					if (!E || E->value.get_storage_id() != owner.get_storage_id()) {
+						bb->data[name] = owner;
+						bb->foreign_links.erase(name);
+						bb->_layout_changed();
+					}
+				} break;
+				case SNAPSHOT_ENTRY_BOUND: {
+					bb->_restore_own_storage(name, false, owner_storages);
+					HashMap<StringName, BBVariable>::Iterator E = bb->data.find(name);
+					if (entry.path.is_empty()) {
+						// Bound to an object outside of the scene tree: only the current binding can be kept.
+						if (!E || !E->value.is_bound() || E->value.get_bound_property() != entry.target) {
+							WARN_PRINT(vformat("Blackboard: Can't restore binding of variable \"%s\" - the bound object is not a node in the scene tree.", name));
+							if (!E) {
+								bb->set_var(name, Variant());
+							}
+						}
+						break;
+					}
+					Node *node = scene_root ? scene_root->get_node_or_null(NodePath(entry.path)) : nullptr;
+					if (node == nullptr) {
+						WARN_PRINT(vformat("Blackboard: Can't restore binding of variable \"%s\" - node not found: %s", name, entry.path));
+						if (!E) {
+							bb->set_var(name, Variant());
+						}
+						break;
+					}
+					if (!E || E->value.get_bound_object_id() != uint64_t(node->get_instance_id()) || E->value.get_bound_property() != entry.target) {
+						bb->bind_var_to_property(name, node, entry.target, true);
+					}
+				} break;
+			}
+			HashMap<StringName, BBVariable>::ConstIterator E = bb->data.find(name);
+			if (E && entry.kind != SNAPSHOT_ENTRY_LINK) {
+				owner_storages.insert(E->value.get_storage_id());
+			}
+		}
+
+		// Erase variables that didn't exist when the snapshot was taken.
+		LocalVector<StringName> to_erase;
+		for (const KeyValue<StringName, BBVariable> &kv : bb->data) {
+			if (!restored.has(kv.key)) {
+				to_erase.push_back(kv.key);
+			}
+		}
+		for (const StringName &name : to_erase) {
+			bb->erase_var(name);
+		}
+	}
+}
+
+void Blackboard::_restore_own_storage(const StringName &p_name, bool p_unbind, const HashSet<uint64_t> &p_owner_storages) {
+	// The variable had storage of its own when the snapshot was taken. If it now shares storage with another restored variable
+	// or a foreign blackboard, or is bound while it shouldn't be, it's detached, so that restoring it doesn't write through.
+	HashMap<StringName, BBVariable>::Iterator E = data.find(p_name);
+	if (!E) {
+		return;
+	}
+	const BBVariable &current = E->value;
+	if (!(p_unbind && current.is_bound()) && !foreign_links.has(p_name) && !p_owner_storages.has(current.get_storage_id())) {
+		return;
+	}
+	BBVariable var(current.get_type(), current.get_hint(), current.get_hint_string());
+	if (!p_unbind && current.is_bound()) {
+		Object *obj = OBJECT_DB_GET_INSTANCE(current.get_bound_object_id());
+		if (obj) {
+			var.bind(obj, current.get_bound_property());
+		}
+	}
+	E->value = var;
+	foreign_links.erase(p_name);
+	_layout_changed();
+}
+
 void Blackboard::bind_var_to_property(const StringName &p_name, Object *p_object, const StringName &p_property, bool p_create) {
 	if (!data.has(p_name)) {
 		if (p_create) {
 			data.insert(p_name, BBVariable());
+			_layout_changed();
 		} else {
 			ERR_FAIL_MSG("Blackboard: Can't bind variable that doesn't exist (var: " + p_name + ").");
 		}
 	}
 	data[p_name].bind(p_object, p_property);
+	_layout_changed();
 }
 
 void Blackboard::unbind_var(const StringName &p_name) {
 	ERR_FAIL_COND_MSG(!data.has(p_name), "Blackboard: Can't unbind variable that doesn't exist (var: " + p_name + ").");
 	data[p_name].unbind();
+	_layout_changed();
+}
+
+bool Blackboard::has_external_vars() const {
+	if (!foreign_links.is_empty()) {
+		return true;
+	}
+	for (const KeyValue<StringName, BBVariable> &kv : data) {
+		if (kv.value.is_bound()) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void Blackboard::assign_var(const StringName &p_name, const BBVariable &p_var) {
 	data.insert(p_name, p_var);
+	_layout_changed();
 }
 
 void Blackboard::link_var(const StringName &p_name, const Ref<Blackboard> &p_target_blackboard, const StringName &p_target_var, bool p_create) {
@@ -133,6 +467,149 @@ void Blackboard::link_var(const StringName &p_name, const Ref<Blackboard> &p_tar
 	ERR_FAIL_COND_MSG(p_target_blackboard.is_null(), "Blackboard: Can't link variable to target blackboard that is null (var: " + p_name + ").");
 	ERR_FAIL_COND_MSG(!p_target_blackboard->data.has(p_target_var), "Blackboard: Can't link variable to non-existent target (var: " + p_name + ", target: " + p_target_var + ").");
 	data[p_name] = p_target_blackboard->data[p_target_var];
+	bool in_chain = false;
+	for (const Blackboard *bb = this; bb && !in_chain; bb = bb->parent.ptr()) {
+		in_chain = bb == p_target_blackboard.ptr();
+	}
+	if (in_chain) {
+		foreign_links.erase(p_name);
+	} else {
+		foreign_links.insert(p_name);
+	}
+	_layout_changed();
+}
+
+uint32_t Blackboard::get_var_version(const StringName &p_name) const {
+	HashMap<StringName, BBVariable>::ConstIterator E = data.find(p_name);
+	if (E) {
+		return E->value.get_version();
+	}
+	if (parent.is_valid()) {
+		const BBVarHandle &handle = _resolve_in_parent_scopes(p_name);
+		if (handle.found) {
+			return handle.var.get_version();
+		}
+	}
+	return 0;
+}
+
+void Blackboard::subscribe_var(const StringName &p_name, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(!p_callback.is_valid(), "Blackboard: Can't subscribe with an invalid callable (var: " + p_name + ").");
+	for (const VarSubscription &sub : subscriptions) {
+		ERR_FAIL_COND_MSG(sub.handle.name == p_name && sub.callback == p_callback, "Blackboard: Callable is already subscribed to variable: " + p_name);
+	}
+	VarSubscription sub;
+	sub.handle = resolve_var(p_name);
+	sub.callback = p_callback;
+	sub.found = sub.handle.found;
+	sub.version = sub.found ? sub.handle.var.get_version() : 0;
+	subscriptions.push_back(sub);
+}
+
+void Blackboard::unsubscribe_var(const StringName &p_name, const Callable &p_callback) {
+	for (uint32_t i = 0; i < subscriptions.size(); i++) {
+		if (subscriptions[i].handle.name == p_name && subscriptions[i].callback == p_callback) {
+			subscriptions.remove_at(i);
+			return;
+		}
+	}
+}
+
+void Blackboard::dispatch_var_changes() {
+	if (subscriptions.is_empty()) {
+		return;
+	}
+
+	struct Notification {
+		StringName name;
+		Callable callback;
+	};
+	LocalVector<Notification> notifications;
+
+	for (VarSubscription &sub : subscriptions) {
+		if (unlikely(!_is_handle_valid(sub.handle))) {
+			_resolve_handle(sub.handle);
+		}
+		uint32_t version = sub.handle.found ? sub.handle.var.get_version() : 0;
+		if (version != sub.version || sub.handle.found != sub.found) {
+			sub.version = version;
+			sub.found = sub.handle.found;
+			notifications.push_back({ sub.handle.name, sub.callback });
+		}
+	}
+
+	// Callbacks are invoked after the scan, since they may alter the blackboard or the subscriptions.
+	for (const Notification &n : notifications) {
+		n.callback.call(n.name, get_var(n.name, Variant(), false));
+	}
+}
+
+void Blackboard::_resolve_handle(BBVarHandle &r_handle) const {
+	// The handle depends only on the scopes inspected up to the one holding the variable.
+	r_handle.epoch = 0;
+	r_handle.depth = 0;
+	r_handle.blackboard = this;
+	r_handle.found = false;
+	r_handle.local = false;
+	const Blackboard *bb = this;
+	while (bb) {
+		r_handle.epoch += bb->layout_epoch;
+		r_handle.depth += 1;
+		HashMap<StringName, BBVariable>::ConstIterator E = bb->data.find(r_handle.name);
+		if (E) {
+			r_handle.var = E->value;
+			r_handle.found = true;
+			r_handle.local = (bb == this);
+			return;
+		}
+		bb = bb->parent.ptr();
+	}
+}
+
+BBVarHandle Blackboard::resolve_var(const StringName &p_name) const {
+	BBVarHandle handle;
+	handle.name = p_name;
+	_resolve_handle(handle);
+	return handle;
+}
+
+Variant Blackboard::get_var_by_handle(BBVarHandle &r_handle, const Variant &p_default, bool p_complain) const {
+	if (unlikely(!_is_handle_valid(r_handle))) {
+		_resolve_handle(r_handle);
+	}
+	if (likely(r_handle.found)) {
+		return r_handle.var.get_value();
+	}
+	if (p_complain) {
+		ERR_PRINT(vformat("Blackboard: Variable \"%s\" not found.", r_handle.name));
+	}
+	return p_default;
+}
+
+void Blackboard::set_var_by_handle(BBVarHandle &r_handle, const Variant &p_value) {
+	if (unlikely(!_is_handle_valid(r_handle))) {
+		_resolve_handle(r_handle);
+	}
+	if (likely(r_handle.found && r_handle.local)) {
+		r_handle.var.set_value(p_value);
+	} else {
+		// Like set_var(), creates the variable in this scope.
+		set_var(r_handle.name, p_value);
+	}
+}
+
+bool Blackboard::has_var_by_handle(BBVarHandle &r_handle) const {
+	if (unlikely(!_is_handle_valid(r_handle))) {
+		_resolve_handle(r_handle);
+	}
+	return r_handle.found;
+}
+
+uint32_t Blackboard::get_var_version_by_handle(BBVarHandle &r_handle) const {
+	if (unlikely(!_is_handle_valid(r_handle))) {
+		_resolve_handle(r_handle);
+	}
+	return r_handle.found ? r_handle.var.get_version() : 0;
 }
 
 void Blackboard::_bind_methods() {
@@ -147,8 +624,14 @@ void Blackboard::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("print_state"), &Blackboard::print_state);
 	ClassDB::bind_method(D_METHOD("get_vars_as_dict"), &Blackboard::get_vars_as_dict);
 	ClassDB::bind_method(D_METHOD("populate_from_dict", "dictionary"), &Blackboard::populate_from_dict);
+	ClassDB::bind_method(D_METHOD("save_snapshot"), &Blackboard::save_snapshot);
+	ClassDB::bind_method(D_METHOD("load_snapshot", "snapshot"), &Blackboard::load_snapshot);
 	ClassDB::bind_method(D_METHOD("top"), &Blackboard::top);
 	ClassDB::bind_method(D_METHOD("bind_var_to_property", "var_name", "object", "property", "create"), &Blackboard::bind_var_to_property, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("unbind_var", "var_name"), &Blackboard::unbind_var);
 	ClassDB::bind_method(D_METHOD("link_var", "var_name", "target_blackboard", "target_var", "create"), &Blackboard::link_var, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_var_version", "var_name"), &Blackboard::get_var_version);
+	ClassDB::bind_method(D_METHOD("subscribe_var", "var_name", "callable"), &Blackboard::subscribe_var);
+	ClassDB::bind_method(D_METHOD("unsubscribe_var", "var_name", "callable"), &Blackboard::unsubscribe_var);
+	ClassDB::bind_method(D_METHOD("dispatch_var_changes"), &Blackboard::dispatch_var_changes);
 }
@@ -17,6 +17,8 @@
 #ifdef LIMBOAI_MODULE
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 #include "core/variant/variant.h"
 #endif // LIMBOAI_MODULE
@@ -26,17 +28,82 @@
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 using namespace godot;
 #endif // LIMBOAI_GDEXTENSION
 
+class Blackboard;
+
+// Resolved reference to a blackboard variable, used by tasks to avoid name lookups in hot paths.
+// Shares storage with the variable, and is re-resolved whenever variables are added, removed or relinked
+// in any of the scopes it was resolved through.
+struct BBVarHandle {
+	StringName name;
+	BBVariable var;
+	const Blackboard *blackboard = nullptr;
+	uint32_t epoch = 0; // Sum of layout epochs of the scopes resolved through; 0 if never resolved.
+	uint32_t depth = 0; // Number of scopes resolved through.
+	bool found = false;
+	bool local = false; // Found in the resolving blackboard rather than in a parent scope.
+
+	void reset(const StringName &p_name) {
+		name = p_name;
+		epoch = 0;
+	}
+};
+
 class Blackboard : public RefCounted {
 	GDCLASS(Blackboard, RefCounted);
 
 private:
+	// Incremented on any change to the layout of this blackboard, invalidating handles resolved through it.
+	uint32_t layout_epoch = 1;
+	HashSet<StringName> foreign_links; // Variables sharing storage with a blackboard outside of this scope chain.
+
 	HashMap<StringName, BBVariable> data;
 	Ref<Blackboard> parent;
 
+	// Variables resolved in parent scopes. Each entry is a handle, validated against the epochs of the scopes it was resolved through.
+	mutable HashMap<StringName, BBVarHandle> scope_cache;
+
+	struct VarSubscription {
+		BBVarHandle handle;
+		Callable callback;
+		uint32_t version = 0; // Version at the last dispatch.
+		bool found = false;
+	};
+	LocalVector<VarSubscription> subscriptions;
+
+	_FORCE_INLINE_ void _layout_changed() { layout_epoch++; }
+	_FORCE_INLINE_ bool _is_handle_valid(const BBVarHandle &p_handle) const {
+		if (p_handle.blackboard != this) {
+			return false;
+		}
+		// Epochs only increase, so the sum changes whenever any of the scopes changes its layout.
+		uint32_t epoch = layout_epoch;
+		const Blackboard *bb = parent.ptr();
+		for (uint32_t i = 1; i < p_handle.depth && bb; i++) {
+			epoch += bb->layout_epoch;
+			bb = bb->parent.ptr();
+		}
+		return p_handle.epoch == epoch;
+	}
+	void _resolve_handle(BBVarHandle &r_handle) const;
+	const BBVarHandle &_resolve_in_parent_scopes(const StringName &p_name) const;
+
+	struct SnapshotEntry {
+		StringName name;
+		uint8_t kind = 0;
+		Variant value;
+		String path; // Node or resource path.
+		uint32_t owner_scope = 0; // For links.
+		StringName target; // Owner variable for links, or bound property.
+	};
+	bool _parse_snapshot(const PackedByteArray &p_snapshot, LocalVector<LocalVector<SnapshotEntry>> &r_scopes) const;
+	void _restore_own_storage(const StringName &p_name, bool p_unbind, const HashSet<uint64_t> &p_owner_storages);
+
 protected:
 	static void _bind_methods();
 
@@ -45,7 +112,7 @@ protected:
 #endif
 
 public:
-	void set_parent(const Ref<Blackboard> &p_blackboard) { parent = p_blackboard; }
+	void set_parent(const Ref<Blackboard> &p_blackboard);
 	Ref<Blackboard> get_parent() const { return parent; }
 
 	Ref<Blackboard> top() const;
@@ -55,19 +122,63 @@ public:
 	bool has_var(const StringName &p_name) const;
 	_FORCE_INLINE_ bool has_local_var(const StringName &p_name) const { return data.has(p_name); }
 	void erase_var(const StringName &p_name);
-	void clear() { data.clear(); }
+	void clear();
 	TypedArray<StringName> list_vars() const;
 	void print_state() const;
 
 	Dictionary get_vars_as_dict() const;
 	void populate_from_dict(const Dictionary &p_dictionary);
 
+	PackedByteArray save_snapshot() const;
+	void load_snapshot(const PackedByteArray &p_snapshot);
+	// True if the snapshot can be loaded into this blackboard; prints the reason if it can't.
+	bool is_snapshot_valid(const PackedByteArray &p_snapshot) const;
+
 	void bind_var_to_property(const StringName &p_name, Object *p_object, const StringName &p_property, bool p_create = false);
 	void unbind_var(const StringName &p_name);
 
+	// True if a variable of this blackboard is bound to an object property, or linked to a blackboard outside of its scope chain.
+	bool has_external_vars() const;
+	// Changes whenever variables are added, removed, linked, bound or unbound, or the parent scope changes.
+	_FORCE_INLINE_ uint32_t get_layout_epoch() const { return layout_epoch; }
+
 	void assign_var(const StringName &p_name, const BBVariable &p_var);
 
 	void link_var(const StringName &p_name, const Ref<Blackboard> &p_target_blackboard, const StringName &p_target_var, bool p_create = false);
+
+	// * Change tracking: versions are incremented on every write; subscribers are notified in batches.
+	uint32_t get_var_version(const StringName &p_name) const;
+	void subscribe_var(const StringName &p_name, const Callable &p_callback);
+	void unsubscribe_var(const StringName &p_name, const Callable &p_callback);
+	void dispatch_var_changes();
+
+	// * Handle-based access: same semantics as the name-based methods above.
+	BBVarHandle resolve_var(const StringName &p_name) const;
+	Variant get_var_by_handle(BBVarHandle &r_handle, const Variant &p_default = Variant(), bool p_complain = true) const;
+	void set_var_by_handle(BBVarHandle &r_handle, const Variant &p_value);
+	bool has_var_by_handle(BBVarHandle &r_handle) const;
+	uint32_t get_var_version_by_handle(BBVarHandle &r_handle) const;
+
+	// * Typed handle-based access: see BBVariable::get_typed().
+	template <typename T>
+	T get_typed_by_handle(BBVarHandle &r_handle, const T &p_default = T()) const {
+		if (unlikely(!_is_handle_valid(r_handle))) {
+			_resolve_handle(r_handle);
+		}
+		return likely(r_handle.found) ? r_handle.var.get_typed<T>() : p_default;
+	}
+
+	template <typename T>
+	void set_typed_by_handle(BBVarHandle &r_handle, const T &p_value) {
+		if (unlikely(!_is_handle_valid(r_handle))) {
+			_resolve_handle(r_handle);
+		}
+		if (likely(r_handle.found && r_handle.local)) {
+			r_handle.var.set_typed<T>(p_value);
+		} else {
+			set_var_by_handle(r_handle, p_value);
+		}
+	}
 };
 
 #endif // BLACKBOARD_H
@@ -24,6 +24,7 @@
 #endif
 
 bool BlackboardPlan::_set(const StringName &p_name, const Variant &p_value) {
+	_invalidate_population_steps();
 	String name_str = p_name;
 
 #ifdef TOOLS_ENABLED
@@ -276,6 +277,7 @@ bool BlackboardPlan::_property_get_revert(const StringName &p_name, Variant &r_p
 }
 
 void BlackboardPlan::set_base_plan(const Ref<BlackboardPlan> &p_base) {
+	_invalidate_population_steps();
 	if (p_base == this) {
 		WARN_PRINT_ED("BlackboardPlan: Using same resource for derived blackboard plan is not supported.");
 		base.unref();
@@ -302,11 +304,13 @@ bool BlackboardPlan::has_mapping(const StringName &p_name) const {
 }
 
 void BlackboardPlan::set_property_binding(const StringName &p_name, const NodePath &p_path) {
+	_invalidate_population_steps();
 	property_bindings[p_name] = p_path;
 	emit_changed();
 }
 
 void BlackboardPlan::set_prefetch_nodepath_vars(bool p_enable) {
+	_invalidate_population_steps();
 	prefetch_nodepath_vars = p_enable;
 	emit_changed();
 }
@@ -319,7 +323,21 @@ bool BlackboardPlan::is_prefetching_nodepath_vars() const {
 	}
 }
 
+void BlackboardPlan::set_share_collections(bool p_enable) {
+	share_collections = p_enable;
+	emit_changed();
+}
+
+bool BlackboardPlan::is_sharing_collections() const {
+	if (is_derived()) {
+		return base->is_sharing_collections();
+	} else {
+		return share_collections;
+	}
+}
+
 void BlackboardPlan::add_var(const StringName &p_name, const BBVariable &p_var) {
+	_invalidate_population_steps();
 	ERR_FAIL_COND(p_name == StringName());
 	ERR_FAIL_COND(var_map.has(p_name));
 	var_map.insert(p_name, p_var);
@@ -329,6 +347,7 @@ void BlackboardPlan::add_var(const StringName &p_name, const BBVariable &p_var)
 }
 
 void BlackboardPlan::remove_var(const StringName &p_name) {
+	_invalidate_population_steps();
 	ERR_FAIL_COND(!var_map.has(p_name));
 	var_list.erase(Pair<StringName, BBVariable>(p_name, var_map[p_name]));
 	var_map.erase(p_name);
@@ -373,6 +392,7 @@ bool BlackboardPlan::is_valid_var_name(const StringName &p_name) const {
 }
 
 void BlackboardPlan::rename_var(const StringName &p_name, const StringName &p_new_name) {
+	_invalidate_population_steps();
 	if (p_name == p_new_name) {
 		return;
 	}
@@ -399,6 +419,7 @@ void BlackboardPlan::rename_var(const StringName &p_name, const StringName &p_ne
 }
 
 void BlackboardPlan::move_var(int p_index, int p_new_index) {
+	_invalidate_population_steps();
 	ERR_FAIL_INDEX(p_index, (int)var_map.size());
 	ERR_FAIL_INDEX(p_new_index, (int)var_map.size());
 
@@ -502,63 +523,86 @@ Ref<Blackboard> BlackboardPlan::create_blackboard(Node *p_prefetch_root, const R
 	return bb;
 }
 
+void BlackboardPlan::_compile_population_steps() {
+	population_steps.clear();
+	population_steps.reserve(var_list.size());
+	for (const Pair<StringName, BBVariable> &p : var_list) {
+		PopulationStep step;
+		step.name = p.first;
+		step.var = p.second;
+		if (parent_scope_mapping.has(p.first)) {
+			step.target = parent_scope_mapping[p.first];
+			step.kind = step.target == StringName() ? PopulationStep::ASSIGN : PopulationStep::LINK;
+		} else if (has_property_binding(p.first) || (is_derived() && base->has_property_binding(p.first))) {
+			bool inherited = !has_property_binding(p.first);
+			const NodePath &binding_path = inherited ? base->property_bindings[p.first] : property_bindings[p.first];
+			if (binding_path.get_subname_count() != 1) {
+				ERR_PRINT(vformat("BlackboardPlan: Can't bind variable %s using property path that contains multiple sub-names: %s", LimboUtility::get_singleton()->decorate_var(p.first), binding_path));
+			} else {
+				step.kind = inherited ? PopulationStep::BIND_TO_BASE_SCENE : PopulationStep::BIND;
+				step.node_path = NodePath(binding_path.get_concatenated_names());
+				step.target = binding_path.get_subname(0);
+			}
+		} else if (prefetch_nodepath_vars) {
+			step.kind = PopulationStep::PREFETCH;
+		}
+		population_steps.push_back(step);
+	}
+	compiled_revision = revision;
+	compiled_base_revision = is_derived() ? base->revision : 0;
+}
+
 void BlackboardPlan::populate_blackboard(const Ref<Blackboard> &p_blackboard, bool overwrite, Node *p_prefetch_root, Node *p_prefetch_root_for_base_plan) {
 	ERR_FAIL_COND(p_prefetch_root == nullptr && prefetch_nodepath_vars);
 	ERR_FAIL_COND(p_blackboard.is_null());
-	for (const Pair<StringName, BBVariable> &p : var_list) {
-		if (p_blackboard->has_local_var(p.first) && !overwrite) {
+	if (compiled_revision != revision || (is_derived() && compiled_base_revision != base->revision)) {
+		_compile_population_steps();
+	}
+	const bool share_read_only = is_sharing_collections();
+	for (const PopulationStep &step : population_steps) {
+		if (!overwrite && p_blackboard->has_local_var(step.name)) {
 #ifdef DEBUG_ENABLED
-			Variant::Type existing_type = p_blackboard->get_var(p.first).get_type();
-			Variant::Type planned_type = p.second.get_type();
+			Variant::Type existing_type = p_blackboard->get_var(step.name).get_type();
+			Variant::Type planned_type = step.var.get_type();
 			if (existing_type != planned_type && existing_type != Variant::NIL && planned_type != Variant::NIL && !(existing_type == Variant::OBJECT && planned_type == Variant::NODE_PATH)) {
 				WARN_PRINT(vformat("BlackboardPlan: Not overwriting %s as it already exists in the blackboard, but it has a different type than planned (%s vs %s). File: %s",
-						LimboUtility::get_singleton()->decorate_var(p.first), Variant::get_type_name(existing_type), Variant::get_type_name(planned_type), get_path()));
+						LimboUtility::get_singleton()->decorate_var(step.name), Variant::get_type_name(existing_type), Variant::get_type_name(planned_type), get_path()));
 			}
 #endif
 			continue;
 		}
-		bool is_bound = has_property_binding(p.first) || (is_derived() && get_base_plan()->has_property_binding(p.first));
-		bool has_mapping = parent_scope_mapping.has(p.first);
-		bool do_prefetch = !is_bound && !has_mapping && prefetch_nodepath_vars;
 
 		// Add a variable duplicate to the blackboard, optionally with NodePath prefetch.
-		BBVariable var = p.second.duplicate(true);
-		if (unlikely(do_prefetch && p.second.get_type() == Variant::NODE_PATH)) {
-			Node *prefetch_root = !p_prefetch_root_for_base_plan || !is_derived() || is_derived_var_changed(p.first) ? p_prefetch_root : p_prefetch_root_for_base_plan;
-			Node *n = prefetch_root->get_node_or_null(p.second.get_value());
+		BBVariable var = step.var.duplicate_deferred(share_read_only);
+		if (unlikely(step.kind == PopulationStep::PREFETCH && step.var.get_type() == Variant::NODE_PATH)) {
+			// A derived plan prefetches unchanged variables relative to the base plan's scene.
+			Node *prefetch_root = !p_prefetch_root_for_base_plan || !is_derived() || step.var.is_value_changed() ? p_prefetch_root : p_prefetch_root_for_base_plan;
+			Node *n = prefetch_root->get_node_or_null(step.var.get_value());
 			if (n != nullptr) {
 				var.set_value(n);
 			} else {
-				ERR_PRINT(vformat("BlackboardPlan: Prefetch failed for variable $%s with value: %s", p.first, p.second.get_value()));
+				ERR_PRINT(vformat("BlackboardPlan: Prefetch failed for variable $%s with value: %s", step.name, step.var.get_value()));
 				var.set_value(Variant());
 			}
 		}
-		p_blackboard->assign_var(p.first, var);
-
-		if (has_mapping) {
-			StringName target_var = parent_scope_mapping[p.first];
-			if (target_var != StringName()) {
-				ERR_CONTINUE_MSG(p_blackboard->get_parent().is_null(), vformat("BlackboardPlan: Cannot link variable %s to parent scope because the parent scope is not set.", LimboUtility::get_singleton()->decorate_var(p.first)));
-				p_blackboard->link_var(p.first, p_blackboard->get_parent(), target_var);
-			}
-		} else if (is_bound) {
-			// Bind variable to a property of a scene node.
-			NodePath binding_path;
-			Node *binding_root;
-			if (has_property_binding(p.first)) {
-				binding_path = property_bindings[p.first];
-				binding_root = p_prefetch_root;
-			} else {
-				binding_path = get_base_plan()->property_bindings[p.first];
-				binding_root = p_prefetch_root_for_base_plan;
-			}
-			ERR_CONTINUE_MSG(binding_path.get_subname_count() != 1, vformat("BlackboardPlan: Can't bind variable %s using property path that contains multiple sub-names: %s", LimboUtility::get_singleton()->decorate_var(p.first), binding_path));
-			NodePath node_path{ binding_path.get_concatenated_names() };
-			StringName prop_name = binding_path.get_subname(0);
-			// TODO: Implement binding for base plan as well.
-			Node *n = binding_root->get_node_or_null(node_path);
-			ERR_CONTINUE_MSG(n == nullptr, vformat("BlackboardPlan: Binding failed for variable %s using property path: %s", LimboUtility::get_singleton()->decorate_var(p.first), binding_path));
-			var.bind(n, prop_name);
+		p_blackboard->assign_var(step.name, var);
+
+		switch (step.kind) {
+			case PopulationStep::LINK: {
+				ERR_CONTINUE_MSG(p_blackboard->get_parent().is_null(), vformat("BlackboardPlan: Cannot link variable %s to parent scope because the parent scope is not set.", LimboUtility::get_singleton()->decorate_var(step.name)));
+				p_blackboard->link_var(step.name, p_blackboard->get_parent(), step.target);
+			} break;
+			case PopulationStep::BIND:
+			case PopulationStep::BIND_TO_BASE_SCENE: {
+				// Bind variable to a property of a scene node.
+				// TODO: Implement binding for base plan as well.
+				Node *binding_root = step.kind == PopulationStep::BIND ? p_prefetch_root : p_prefetch_root_for_base_plan;
+				Node *n = binding_root ? binding_root->get_node_or_null(step.node_path) : nullptr;
+				ERR_CONTINUE_MSG(n == nullptr, vformat("BlackboardPlan: Binding failed for variable %s using property path: %s:%s", LimboUtility::get_singleton()->decorate_var(step.name), step.node_path, step.target));
+				var.bind(n, step.target);
+			} break;
+			default: {
+			} break;
 		}
 	}
 }
@@ -566,6 +610,8 @@ void BlackboardPlan::populate_blackboard(const Ref<Blackboard> &p_blackboard, bo
 void BlackboardPlan::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_prefetch_nodepath_vars", "enable"), &BlackboardPlan::set_prefetch_nodepath_vars);
 	ClassDB::bind_method(D_METHOD("is_prefetching_nodepath_vars"), &BlackboardPlan::is_prefetching_nodepath_vars);
+	ClassDB::bind_method(D_METHOD("set_share_collections", "enable"), &BlackboardPlan::set_share_collections);
+	ClassDB::bind_method(D_METHOD("is_sharing_collections"), &BlackboardPlan::is_sharing_collections);
 
 	ClassDB::bind_method(D_METHOD("set_base_plan", "blackboard_plan"), &BlackboardPlan::set_base_plan);
 	ClassDB::bind_method(D_METHOD("get_base_plan"), &BlackboardPlan::get_base_plan);
@@ -578,6 +624,7 @@ void BlackboardPlan::_bind_methods() {
 
 	// To avoid cluttering the member namespace, we do not export unnecessary properties in this class.
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "prefetch_nodepath_vars", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_prefetch_nodepath_vars", "is_prefetching_nodepath_vars");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "share_collections", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE), "set_share_collections", "is_sharing_collections");
 }
 
 BlackboardPlan::BlackboardPlan() {
@@ -18,10 +18,12 @@
 
 #ifdef LIMBOAI_MODULE
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #endif // LIMBOAI_MODULE
 
 #ifdef LIMBOAI_GDEXTENSION
 #include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 using namespace godot;
 #endif // LIMBOAI_GDEXTENSION
 
@@ -53,6 +55,34 @@ private:
 	// If true, NodePath variables will be prefetched, so that the vars will contain node pointers instead (upon BB creation/population).
 	bool prefetch_nodepath_vars = true;
 
+	// If true, Array and Dictionary values are shared with populated blackboards as read-only copies, instead of being copied on first access.
+	bool share_collections = false;
+
+	// Flat list of steps to populate a blackboard, compiled from the plan on first use after a change.
+	struct PopulationStep {
+		enum Kind : uint8_t {
+			ASSIGN,
+			PREFETCH, // Prefetch applies only if the variable holds a NodePath.
+			LINK,
+			BIND,
+			BIND_TO_BASE_SCENE, // Binding inherited from the base plan.
+		};
+
+		StringName name;
+		BBVariable var; // Shares storage with the plan variable.
+		Kind kind = ASSIGN;
+		StringName target; // LINK: parent scope variable; BIND: property name.
+		NodePath node_path; // BIND: path to the bound node.
+	};
+
+	LocalVector<PopulationStep> population_steps;
+	uint32_t revision = 1; // Incremented on every change that affects population.
+	uint32_t compiled_revision = 0;
+	uint32_t compiled_base_revision = 0;
+
+	_FORCE_INLINE_ void _invalidate_population_steps() { revision++; }
+	void _compile_population_steps();
+
 	_FORCE_INLINE_ bool _is_var_nil(const BBVariable &p_var) const { return p_var.get_type() == Variant::NIL; }
 	_FORCE_INLINE_ bool _is_var_private(const String &p_name, const BBVariable &p_var) const { return is_derived() && p_name.begins_with("_"); }
 
@@ -86,6 +116,9 @@ public:
 	void set_prefetch_nodepath_vars(bool p_enable);
 	bool is_prefetching_nodepath_vars() const;
 
+	void set_share_collections(bool p_enable);
+	bool is_sharing_collections() const;
+
 	void add_var(const StringName &p_name, const BBVariable &p_var);
 	void remove_var(const StringName &p_name);
 	BBVariable get_var(const StringName &p_name);
@@ -84,7 +84,7 @@ Ref<BTInstance> BehaviorTree::instantiate(Node *p_agent, const Ref<Blackboard> &
 	ERR_FAIL_NULL_V_MSG(scene_root, nullptr, "BehaviorTree: Instantiation failed - unable to establish scene root. This is likely due to the instance owner not being owned by a scene node and custom_scene_root being null.");
 	Ref<BTTask> root_copy = root_task->clone();
 	root_copy->initialize(p_agent, p_blackboard, scene_root);
-	return BTInstance::create(root_copy, get_path(), p_instance_owner);
+	return BTInstance::create(root_copy, get_path(), p_instance_owner, uint64_t(get_instance_id()));
 }
 
 void BehaviorTree::emit_branch_changed(const Ref<BTTask> &p_branch) {
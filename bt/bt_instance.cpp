@@ -11,26 +11,66 @@
 
 #include "bt_instance.h"
 
+#include "../blackboard/bb_param/bb_param.h"
 #include "../compat/object.h"
 #include "../compat/performance.h"
 #include "../editor/debugger/limbo_debugger.h"
 #include "../util/limbo_string_names.h"
+#include "../util/limbo_task_db.h"
 
 #ifdef LIMBOAI_MODULE
+#include "core/io/stream_peer.h"
+#include "core/object/script_language.h"
 #include "core/os/time.h"
+#include "core/templates/pair.h"
 #include "main/performance.h"
 #endif
 
 #ifdef LIMBOAI_GDEXTENSION
 #include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/classes/script.hpp>
+#include <godot_cpp/classes/stream_peer_buffer.hpp>
 #include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/templates/pair.hpp>
 #endif
 
+namespace {
+
+constexpr uint32_t STATE_MAGIC = 0x5354424C; // "LBTS"
+constexpr uint8_t STATE_FORMAT_VERSION = 3;
+
+// Identifies the type of a task in saved state, so that state isn't loaded into a different tree with the same size.
+uint32_t _get_task_type_hash(const BTTask *p_task) {
+	Ref<Script> task_script = p_task->get_script();
+	String type = p_task->get_class();
+	if (task_script.is_valid()) {
+		type += ":" + task_script->get_path();
+	}
+	return type.hash();
+}
+
+// Reads a value stored with put_var(), failing instead of reading past the end of the data.
+bool _get_var_checked(const Ref<StreamPeerBuffer> &p_stream, Variant &r_value) {
+	if (p_stream->get_available_bytes() < 4) {
+		return false;
+	}
+	int position = p_stream->get_position();
+	uint32_t size = p_stream->get_u32();
+	if (size > (uint32_t)p_stream->get_available_bytes()) {
+		return false;
+	}
+	p_stream->seek(position);
+	r_value = p_stream->get_var();
+	return true;
+}
+
+} // namespace
+
 Node *BTInstance::get_owner_node() const {
 	return owner_node_id ? Object::cast_to<Node>(OBJECT_DB_GET_INSTANCE(owner_node_id)) : nullptr;
 }
 
-Ref<BTInstance> BTInstance::create(Ref<BTTask> p_root_task, String p_source_bt_path, Node *p_owner_node) {
+Ref<BTInstance> BTInstance::create(Ref<BTTask> p_root_task, String p_source_bt_path, Node *p_owner_node, uint64_t p_source_bt_id) {
 	ERR_FAIL_COND_V(p_root_task.is_null(), nullptr);
 	ERR_FAIL_NULL_V(p_owner_node, nullptr);
 	Ref<BTInstance> inst;
@@ -38,19 +78,190 @@ Ref<BTInstance> BTInstance::create(Ref<BTTask> p_root_task, String p_source_bt_p
 	inst->root_task = p_root_task;
 	inst->owner_node_id = p_owner_node->get_instance_id();
 	inst->source_bt_path = p_source_bt_path;
+	inst->source_bt_id = p_source_bt_id;
+	inst->_compile_plan();
 	return inst;
 }
 
-BT::Status BTInstance::update(double p_delta) {
+void BTInstance::_compile_plan_recursive(BTTask *p_task, int p_parent) {
+	int idx = plan.size();
+	plan.push_back(PlanEntry{ Ref<BTTask>(p_task), p_parent, 0, p_task->get_child_count() });
+	for (int i = 0; i < p_task->get_child_count(); i++) {
+		_compile_plan_recursive(p_task->get_child_ptr(i), idx);
+	}
+	plan[idx].subtree_end = plan.size();
+}
+
+void BTInstance::_compile_plan() {
+	// Depth-first pre-order: descendants of an entry occupy the range (idx, subtree_end).
+	plan.clear();
+	if (root_task.is_valid()) {
+		plan_revision = root_task->data.tree_revision;
+		_compile_plan_recursive(root_task.ptr(), -1);
+	}
+
+	tasks_thread_safe = plan.size() > 0;
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		const Ref<BTTask> &task = plan[i].task;
+		tasks_thread_safe = tasks_thread_safe && task->get_script().get_type() == Variant::NIL &&
+				LimboTaskDB::is_task_thread_safe(task->get_class()) && !has_node_params(task.ptr());
+	}
+	// Blackboard part is computed on demand.
+	blackboards.clear();
+	blackboards_epoch = 0;
+	thread_safe_epoch = 0;
+}
+
+void BTInstance::_update_blackboards() {
+	if (blackboards_epoch != 0 && _get_blackboards_epoch() == blackboards_epoch) {
+		return;
+	}
+	// Scopes may have been added or reparented, so blackboards are collected anew.
+	blackboards.clear();
+	for (const PlanEntry &entry : plan) {
+		for (Ref<Blackboard> bb = entry.task->get_blackboard(); bb.is_valid(); bb = bb->get_parent()) {
+			if (blackboards.find(bb) != -1) {
+				break;
+			}
+			blackboards.push_back(bb);
+		}
+	}
+	blackboards_epoch = _get_blackboards_epoch();
+}
+
+bool BTInstance::has_node_params(BTTask *p_task) {
+	// Node parameters access the scene tree, and parameters holding objects may call into them.
+#ifdef LIMBOAI_MODULE
+	List<PropertyInfo> props;
+	p_task->get_property_list(&props);
+	for (List<PropertyInfo>::Element *E = props.front(); E; E = E->next()) {
+		PropertyInfo prop = E->get();
+#elif LIMBOAI_GDEXTENSION
+	TypedArray<Dictionary> props = p_task->get_property_list();
+	for (int i = 0; i < props.size(); i++) {
+		PropertyInfo prop = PropertyInfo::from_dict(props[i]);
+#endif
+		if (!(prop.usage & PROPERTY_USAGE_STORAGE) || (prop.type != Variant::OBJECT && prop.type != Variant::ARRAY)) {
+			continue;
+		}
+		Variant prop_value = p_task->get(prop.name);
+		Array params;
+		if (prop_value.get_type() == Variant::ARRAY) {
+			params = prop_value;
+		} else {
+			params.push_back(prop_value);
+		}
+		for (int j = 0; j < params.size(); j++) {
+			Ref<BBParam> param = params[j];
+			if (param.is_null()) {
+				continue;
+			}
+			Variant::Type type = param->get_type();
+			if (param->is_class("BBNode") || type == Variant::OBJECT || type == Variant::NODE_PATH) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+uint32_t BTInstance::_get_blackboards_epoch() const {
+	// Epochs only increase, so the sum changes whenever any of the blackboards changes its layout.
+	uint32_t epoch = 1;
+	for (const Ref<Blackboard> &bb : blackboards) {
+		epoch += bb->get_layout_epoch();
+	}
+	return epoch;
+}
+
+bool BTInstance::is_thread_safe() {
+	get_execution_plan(); // Recompiled after structural changes.
+	if (!tasks_thread_safe) {
+		return false;
+	}
+	_update_blackboards();
+	if (thread_safe_epoch == blackboards_epoch) {
+		return thread_safe;
+	}
+	thread_safe_epoch = blackboards_epoch;
+
+	// Scope blackboards of BTNewScope and BTSubtree must descend from the instance blackboard,
+	// which in turn must not be shared through a parent scope.
+	Ref<Blackboard> blackboard = get_blackboard();
+	thread_safe = blackboard.is_valid() && blackboard->get_parent().is_null();
+	for (uint32_t i = 0; thread_safe && i < blackboards.size(); i++) {
+		thread_safe = blackboards[i]->top() == blackboard && !blackboards[i]->has_external_vars();
+	}
+	return thread_safe;
+}
+
+const LocalVector<BTInstance::PlanEntry> &BTInstance::get_execution_plan() {
+	// Trees may be restructured from scripts after instantiation; recompile after any structural change.
+	bool valid = plan.size() > 0 && plan[0].task == root_task && plan_revision == root_task->data.tree_revision;
+	if (!valid) {
+		_compile_plan();
+	}
+	return plan;
+}
+
+void BTInstance::_try_enter_dormancy() {
+	BTTask *task = BTTask::_find_sleeping_task(root_task.ptr());
+	if (task == nullptr) {
+		return;
+	}
+
+	dormant = true;
+	dormant_elapsed = 0.0;
+	dormant_time = task->data.sleep_time;
+	has_wake_var = task->data.wake_var != StringName();
+	if (has_wake_var) {
+		wake_blackboard = task->get_blackboard();
+		wake_var = wake_blackboard->resolve_var(task->data.wake_var);
+		wake_var_version = wake_blackboard->get_var_version_by_handle(wake_var);
+		if (wake_var.found && wake_var.var.is_bound()) {
+			wake_var_value = wake_var.var.get_value();
+		}
+	}
+}
+
+bool BTInstance::_is_wake_var_changed() {
+	if (wake_blackboard->get_var_version_by_handle(wake_var) != wake_var_version) {
+		return true;
+	}
+	// Bound properties can change without writing to the variable.
+	return wake_var.found && wake_var.var.is_bound() && wake_var.var.get_value() != wake_var_value;
+}
+
+void BTInstance::wake() {
+	// Accumulated delta is passed to the tree on the next update.
+	dormant_time = 0.0;
+}
+
+BT::Status BTInstance::tick(double p_delta) {
 	ERR_FAIL_COND_V(!root_task.is_valid(), BT::FRESH);
 
+	if (dormant) {
+		dormant_elapsed += p_delta;
+		if (dormant_elapsed < dormant_time && root_task->get_status() == BT::RUNNING &&
+				(!has_wake_var || !_is_wake_var_changed())) {
+			return last_status;
+		}
+		p_delta = dormant_elapsed;
+		dormant = false;
+		has_wake_var = false;
+		wake_var = BBVarHandle();
+		wake_var_value = Variant();
+		wake_blackboard.unref();
+	}
+
 #ifdef DEBUG_ENABLED
 	double start = Time::get_singleton()->get_ticks_usec();
 #endif
 
-	const Ref<BTInstance> keep_alive{ this }; // keep instance alive until update is finished
 	last_status = root_task->execute(p_delta);
-	emit_signal(LW_NAME(updated), last_status);
+	if (last_status == BT::RUNNING) {
+		_try_enter_dormancy();
+	}
 
 #ifdef DEBUG_ENABLED
 	double end = Time::get_singleton()->get_ticks_usec();
@@ -60,6 +271,219 @@ BT::Status BTInstance::update(double p_delta) {
 	return last_status;
 }
 
+void BTInstance::dispatch_var_changes() {
+	get_execution_plan(); // Recompiled after structural changes.
+	_update_blackboards();
+	for (const Ref<Blackboard> &bb : blackboards) {
+		bb->dispatch_var_changes();
+	}
+}
+
+BT::Status BTInstance::update(double p_delta) {
+	ERR_FAIL_COND_V(!root_task.is_valid(), BT::FRESH);
+	const Ref<BTInstance> keep_alive{ this }; // keep instance alive until update is finished
+	tick(p_delta);
+	dispatch_var_changes();
+	emit_signal(LW_NAME(updated), last_status);
+	return last_status;
+}
+
+void BTInstance::reset(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node *p_instance_owner, Node *p_scene_root) {
+	ERR_FAIL_COND(!root_task.is_valid());
+	ERR_FAIL_NULL(p_agent);
+	ERR_FAIL_COND(p_blackboard.is_null());
+	ERR_FAIL_NULL(p_instance_owner);
+	ERR_FAIL_NULL(p_scene_root);
+
+	root_task->abort();
+	last_status = BT::FRESH;
+	dormant = false;
+	has_wake_var = false;
+	wake_blackboard.unref();
+	owner_node_id = p_instance_owner->get_instance_id();
+
+	// Tasks are set up again, since they may cache agent- and blackboard-dependent data in _setup().
+	root_task->initialize(p_agent, p_blackboard, p_scene_root);
+	_compile_plan();
+}
+
+PackedByteArray BTInstance::save_state(bool p_include_blackboard) {
+	ERR_FAIL_COND_V(!root_task.is_valid(), PackedByteArray());
+	const LocalVector<PlanEntry> &tasks = get_execution_plan();
+
+	Ref<StreamPeerBuffer> stream;
+	stream.instantiate();
+	stream->put_u32(STATE_MAGIC);
+	stream->put_u8(STATE_FORMAT_VERSION);
+	stream->put_u32(tasks.size());
+	stream->put_u8(last_status);
+
+	stream->put_u8(dormant);
+	if (dormant) {
+		stream->put_double(dormant_elapsed);
+		stream->put_double(dormant_time);
+		// Wake variable is stored with the index of a task that shares its blackboard.
+		int wake_task_idx = -1;
+		for (uint32_t i = 0; has_wake_var && i < tasks.size(); i++) {
+			if (tasks[i].task->get_blackboard() == wake_blackboard) {
+				wake_task_idx = i;
+				break;
+			}
+		}
+		stream->put_32(wake_task_idx);
+		if (wake_task_idx >= 0) {
+			stream->put_utf8_string(String(wake_var.name));
+		}
+	}
+
+	// Task-specific data is stored in separate buffers, so it can be validated before any of it is loaded.
+	Ref<StreamPeerBuffer> task_stream;
+	task_stream.instantiate();
+	for (const PlanEntry &entry : tasks) {
+		const BTTask *task = entry.task.ptr();
+		stream->put_u32(_get_task_type_hash(task));
+		stream->put_u8(task->data.status);
+		stream->put_double(task->data.elapsed);
+		task_stream->clear();
+		task->_save_task_state(task_stream);
+		stream->put_var(task_stream->get_data_array());
+	}
+
+	stream->put_u8(p_include_blackboard);
+	if (p_include_blackboard) {
+		stream->put_var(root_task->get_blackboard()->save_snapshot());
+		// Scope blackboards of BTNewScope and BTSubtree are stored with the index of the task that created them.
+		LocalVector<uint32_t> scopes;
+		for (uint32_t i = 1; i < tasks.size(); i++) {
+			const Ref<Blackboard> &bb = tasks[i].task->get_blackboard();
+			if (bb.is_valid() && bb != tasks[tasks[i].parent].task->get_blackboard()) {
+				scopes.push_back(i);
+			}
+		}
+		stream->put_u32(scopes.size());
+		for (uint32_t idx : scopes) {
+			stream->put_u32(idx);
+			stream->put_var(tasks[idx].task->get_blackboard()->save_snapshot());
+		}
+	}
+	return stream->get_data_array();
+}
+
+void BTInstance::load_state(const PackedByteArray &p_state) {
+	ERR_FAIL_COND(!root_task.is_valid());
+	const LocalVector<PlanEntry> &tasks = get_execution_plan();
+
+	Ref<StreamPeerBuffer> stream;
+	stream.instantiate();
+	stream->set_data_array(p_state);
+	ERR_FAIL_COND_MSG(p_state.size() < 9 || stream->get_u32() != STATE_MAGIC, "BTInstance: Invalid state data.");
+	ERR_FAIL_COND_MSG(stream->get_u8() != STATE_FORMAT_VERSION, "BTInstance: Unsupported state format version.");
+	uint32_t num_tasks = stream->get_u32();
+	ERR_FAIL_COND_MSG(num_tasks != tasks.size(), vformat("BTInstance: Saved state doesn't match the tree structure (%d vs %d tasks).", num_tasks, tasks.size()));
+
+	// * The whole state is parsed and validated first, so corrupted data leaves the instance untouched.
+	ERR_FAIL_COND_MSG(stream->get_available_bytes() < 2, "BTInstance: State data is truncated.");
+	uint8_t saved_last_status = stream->get_u8();
+	ERR_FAIL_COND_MSG(saved_last_status > BT::SUCCESS, "BTInstance: State data is corrupted.");
+	bool saved_dormant = stream->get_u8();
+	double saved_dormant_elapsed = 0.0;
+	double saved_dormant_time = 0.0;
+	int wake_task_idx = -1;
+	StringName wake_var_name;
+	if (saved_dormant) {
+		ERR_FAIL_COND_MSG(stream->get_available_bytes() < 20, "BTInstance: State data is truncated.");
+		saved_dormant_elapsed = stream->get_double();
+		saved_dormant_time = stream->get_double();
+		wake_task_idx = stream->get_32();
+		ERR_FAIL_COND_MSG(wake_task_idx < -1 || wake_task_idx >= (int)tasks.size(), "BTInstance: State data is corrupted.");
+		if (wake_task_idx >= 0) {
+			ERR_FAIL_COND_MSG(stream->get_available_bytes() < 4, "BTInstance: State data is truncated.");
+			wake_var_name = stream->get_utf8_string();
+		}
+	}
+
+	struct TaskState {
+		BT::Status status = BT::FRESH;
+		double elapsed = 0.0;
+		PackedByteArray data;
+	};
+	LocalVector<TaskState> task_states;
+	task_states.resize(tasks.size());
+	for (uint32_t i = 0; i < tasks.size(); i++) {
+		ERR_FAIL_COND_MSG(stream->get_available_bytes() < 13, "BTInstance: State data is truncated.");
+		uint32_t type_hash = stream->get_u32();
+		ERR_FAIL_COND_MSG(type_hash != _get_task_type_hash(tasks[i].task.ptr()), vformat("BTInstance: Saved state doesn't match the tree structure (task %d is %s).", i, tasks[i].task->get_class()));
+		uint8_t status = stream->get_u8();
+		ERR_FAIL_COND_MSG(status > BT::SUCCESS, "BTInstance: State data is corrupted.");
+		task_states[i].status = (BT::Status)status;
+		task_states[i].elapsed = stream->get_double();
+		Variant data;
+		ERR_FAIL_COND_MSG(!_get_var_checked(stream, data) || data.get_type() != Variant::PACKED_BYTE_ARRAY, "BTInstance: State data is corrupted.");
+		task_states[i].data = data;
+	}
+
+	ERR_FAIL_COND_MSG(stream->get_available_bytes() < 1, "BTInstance: State data is truncated.");
+	bool include_blackboard = stream->get_u8();
+	PackedByteArray root_snapshot;
+	LocalVector<Pair<uint32_t, PackedByteArray>> scope_snapshots;
+	if (include_blackboard) {
+		Variant snapshot;
+		ERR_FAIL_COND_MSG(!_get_var_checked(stream, snapshot) || snapshot.get_type() != Variant::PACKED_BYTE_ARRAY, "BTInstance: State data is corrupted.");
+		root_snapshot = snapshot;
+		ERR_FAIL_COND_MSG(!root_task->get_blackboard()->is_snapshot_valid(root_snapshot), "BTInstance: State data is corrupted.");
+		ERR_FAIL_COND_MSG(stream->get_available_bytes() < 4, "BTInstance: State data is truncated.");
+		uint32_t num_scopes = stream->get_u32();
+		ERR_FAIL_COND_MSG(num_scopes > tasks.size(), "BTInstance: State data is corrupted.");
+		for (uint32_t i = 0; i < num_scopes; i++) {
+			ERR_FAIL_COND_MSG(stream->get_available_bytes() < 4, "BTInstance: State data is truncated.");
+			uint32_t idx = stream->get_u32();
+			ERR_FAIL_COND_MSG(idx >= tasks.size() || tasks[idx].task->get_blackboard().is_null(), "BTInstance: State data is corrupted.");
+			ERR_FAIL_COND_MSG(!_get_var_checked(stream, snapshot) || snapshot.get_type() != Variant::PACKED_BYTE_ARRAY, "BTInstance: State data is corrupted.");
+			ERR_FAIL_COND_MSG(!tasks[idx].task->get_blackboard()->is_snapshot_valid(snapshot), "BTInstance: State data is corrupted.");
+			scope_snapshots.push_back(Pair<uint32_t, PackedByteArray>(idx, snapshot));
+		}
+	}
+	ERR_FAIL_COND_MSG(stream->get_available_bytes() != 0, "BTInstance: State data is corrupted.");
+
+	// Running tasks exit before the saved state replaces theirs.
+	root_task->abort();
+
+	last_status = (BT::Status)saved_last_status;
+	dormant = saved_dormant;
+	dormant_elapsed = saved_dormant_elapsed;
+	dormant_time = saved_dormant_time;
+	has_wake_var = false;
+	wake_blackboard.unref();
+
+	Ref<StreamPeerBuffer> task_stream;
+	task_stream.instantiate();
+	for (uint32_t i = 0; i < tasks.size(); i++) {
+		BTTask *task = tasks[i].task.ptr();
+		task->data.status = task_states[i].status;
+		task->data.elapsed = task_states[i].elapsed;
+		task_stream->set_data_array(task_states[i].data);
+		task->_load_task_state(task_stream);
+	}
+
+	if (include_blackboard) {
+		root_task->get_blackboard()->load_snapshot(root_snapshot);
+		// Snapshots include the parent scopes, which are restored to the same values again.
+		for (const Pair<uint32_t, PackedByteArray> &scope : scope_snapshots) {
+			tasks[scope.first].task->get_blackboard()->load_snapshot(scope.second);
+		}
+	}
+
+	if (wake_task_idx >= 0) {
+		has_wake_var = true;
+		wake_blackboard = tasks[wake_task_idx].task->get_blackboard();
+		wake_var = wake_blackboard->resolve_var(wake_var_name);
+		wake_var_version = wake_blackboard->get_var_version_by_handle(wake_var);
+		if (wake_var.found && wake_var.var.is_bound()) {
+			wake_var_value = wake_var.var.get_value();
+		}
+	}
+}
+
 void BTInstance::set_monitor_performance(bool p_monitor) {
 #ifdef DEBUG_ENABLED
 	monitor_performance = p_monitor;
@@ -138,11 +562,17 @@ void BTInstance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_blackboard"), &BTInstance::get_blackboard);
 
 	ClassDB::bind_method(D_METHOD("is_instance_valid"), &BTInstance::is_instance_valid);
+	ClassDB::bind_method(D_METHOD("is_thread_safe"), &BTInstance::is_thread_safe);
+	ClassDB::bind_method(D_METHOD("is_dormant"), &BTInstance::is_dormant);
+	ClassDB::bind_method(D_METHOD("wake"), &BTInstance::wake);
 
 	ClassDB::bind_method(D_METHOD("set_monitor_performance", "monitor"), &BTInstance::set_monitor_performance);
 	ClassDB::bind_method(D_METHOD("get_monitor_performance"), &BTInstance::get_monitor_performance);
 
 	ClassDB::bind_method(D_METHOD("update", "delta"), &BTInstance::update);
+	ClassDB::bind_method(D_METHOD("reset", "agent", "blackboard", "instance_owner", "scene_root"), &BTInstance::reset);
+	ClassDB::bind_method(D_METHOD("save_state", "include_blackboard"), &BTInstance::save_state, DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("load_state", "state"), &BTInstance::load_state);
 
 	ClassDB::bind_method(D_METHOD("register_with_debugger"), &BTInstance::register_with_debugger);
 	ClassDB::bind_method(D_METHOD("unregister_with_debugger"), &BTInstance::unregister_with_debugger);
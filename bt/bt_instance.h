@@ -13,14 +13,49 @@
 
 #include "tasks/bt_task.h"
 
+#ifdef LIMBOAI_MODULE
+#include "core/templates/local_vector.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/templates/local_vector.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
 class BTInstance : public RefCounted {
 	GDCLASS(BTInstance, RefCounted);
 
+public:
+	// Flattened depth-first view of the instantiated tree, compiled once in create().
+	struct PlanEntry {
+		Ref<BTTask> task;
+		int parent = -1; // Index of the parent entry; -1 for the root.
+		int subtree_end = 0; // One past the index of the last descendant.
+		int num_children = 0;
+	};
+
 private:
 	Ref<BTTask> root_task;
+	LocalVector<PlanEntry> plan;
+	uint32_t plan_revision = 0; // Tree revision of the root task when the plan was compiled.
 	uint64_t owner_node_id = 0;
 	String source_bt_path;
+	uint64_t source_bt_id = 0; // Instance ID of the BehaviorTree this instance was created from; 0 if unknown.
 	BT::Status last_status = BT::FRESH;
+	bool tasks_thread_safe = false; // Task part of the check, computed with the plan.
+	bool thread_safe = false;
+	uint32_t thread_safe_epoch = 0; // Value of blackboards_epoch when thread_safe was last computed.
+	LocalVector<Ref<Blackboard>> blackboards; // Distinct blackboards used by the tasks, including parent scopes.
+	uint32_t blackboards_epoch = 0; // Sum of the layout epochs of blackboards when collected; 0 if not collected.
+
+	// Dormancy: while a passive chain of running tasks waits on a sleeping task, the tree is not executed.
+	bool dormant = false;
+	double dormant_elapsed = 0.0; // Delta accumulated while dormant; passed to the tree on wake.
+	double dormant_time = 0.0;
+	bool has_wake_var = false;
+	BBVarHandle wake_var;
+	uint32_t wake_var_version = 0;
+	Variant wake_var_value; // Compared instead of the version for bound variables.
+	Ref<Blackboard> wake_blackboard;
 
 #ifdef DEBUG_ENABLED
 	bool monitor_performance = false;
@@ -34,6 +69,13 @@ private:
 
 #endif // * DEBUG_ENABLED
 
+	void _compile_plan_recursive(BTTask *p_task, int p_parent);
+	void _compile_plan();
+	void _update_blackboards();
+	uint32_t _get_blackboards_epoch() const;
+	void _try_enter_dormancy();
+	bool _is_wake_var_changed();
+
 protected:
 	static void _bind_methods();
 
@@ -46,20 +88,43 @@ public:
 	Node *get_owner_node() const;
 	_FORCE_INLINE_ BT::Status get_last_status() const { return last_status; }
 	_FORCE_INLINE_ String get_source_bt_path() const { return source_bt_path; }
+	_FORCE_INLINE_ uint64_t get_source_bt_id() const { return source_bt_id; }
 	_FORCE_INLINE_ Node *get_agent() const { return root_task.is_valid() ? root_task->get_agent() : nullptr; }
 	_FORCE_INLINE_ Ref<Blackboard> get_blackboard() const { return root_task.is_valid() ? root_task->get_blackboard() : Ref<Blackboard>(); }
 
 	_FORCE_INLINE_ bool is_instance_valid() const { return root_task.is_valid(); }
 
+	const LocalVector<PlanEntry> &get_execution_plan();
+
+	// True if every task in the tree is registered as thread-safe in LimboTaskDB, no task has a script or a node parameter,
+	// the blackboard is not shared through a parent scope, and no variable is bound to a property or linked to another blackboard.
+	// Blackboards are checked again whenever their layout changes.
+	bool is_thread_safe();
+
+	// True if the task has a parameter that resolves a node or holds an object.
+	static bool has_node_params(BTTask *p_task);
+
+	// Dispatches variable changes on every blackboard used by the tree, including scopes and parent blackboards.
+	void dispatch_var_changes();
+
+	// Executes the tree without emitting signals. May be called from a worker thread if is_thread_safe().
+	BT::Status tick(double p_delta);
 	BT::Status update(double p_delta);
 
+	_FORCE_INLINE_ bool is_dormant() const { return dormant; }
+	void wake();
+	void reset(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node *p_instance_owner, Node *p_scene_root);
+
+	PackedByteArray save_state(bool p_include_blackboard = true);
+	void load_state(const PackedByteArray &p_state);
+
 	void set_monitor_performance(bool p_monitor);
 	bool get_monitor_performance() const;
 
 	void register_with_debugger();
 	void unregister_with_debugger();
 
-	static Ref<BTInstance> create(Ref<BTTask> p_root_task, String p_source_bt_path, Node *p_owner_node);
+	static Ref<BTInstance> create(Ref<BTTask> p_root_task, String p_source_bt_path, Node *p_owner_node, uint64_t p_source_bt_id = 0);
 
 	BTInstance() = default;
 	~BTInstance();
@@ -0,0 +1,85 @@
+/**
+ * bt_instance_pool.cpp
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#include "bt_instance_pool.h"
+
+void BTInstancePool::set_behavior_tree(const Ref<BehaviorTree> &p_behavior_tree) {
+	if (behavior_tree != p_behavior_tree) {
+		clear();
+	}
+	behavior_tree = p_behavior_tree;
+}
+
+void BTInstancePool::prewarm(int p_count) {
+	ERR_FAIL_COND_MSG(behavior_tree.is_null(), "BTInstancePool: BehaviorTree is not assigned.");
+	ERR_FAIL_COND_MSG(behavior_tree->get_root_task().is_null(), "BTInstancePool: BehaviorTree has no valid root task.");
+	for (int i = get_available_count(); i < p_count; i++) {
+		Ref<BTTask> root_copy = behavior_tree->get_root_task()->clone();
+		ERR_FAIL_COND(root_copy.is_null());
+		prewarmed.push_back(root_copy);
+	}
+}
+
+Ref<BTInstance> BTInstancePool::acquire(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node *p_instance_owner, Node *p_custom_scene_root) {
+	ERR_FAIL_COND_V_MSG(behavior_tree.is_null(), nullptr, "BTInstancePool: Acquire failed - BehaviorTree is not assigned.");
+	ERR_FAIL_NULL_V_MSG(p_agent, nullptr, "BTInstancePool: Acquire failed - agent can't be null.");
+	ERR_FAIL_NULL_V_MSG(p_instance_owner, nullptr, "BTInstancePool: Acquire failed - instance owner can't be null.");
+	ERR_FAIL_COND_V_MSG(p_blackboard.is_null(), nullptr, "BTInstancePool: Acquire failed - blackboard can't be null.");
+	Node *scene_root = p_custom_scene_root ? p_custom_scene_root : p_instance_owner->get_owner();
+	ERR_FAIL_NULL_V_MSG(scene_root, nullptr, "BTInstancePool: Acquire failed - unable to establish scene root. This is likely due to the instance owner not being owned by a scene node and custom_scene_root being null.");
+
+	if (!released.is_empty()) {
+		Ref<BTInstance> inst = released[released.size() - 1];
+		released.resize(released.size() - 1);
+		inst->reset(p_agent, p_blackboard, p_instance_owner, scene_root);
+		return inst;
+	}
+
+	if (!prewarmed.is_empty()) {
+		Ref<BTTask> root_copy = prewarmed[prewarmed.size() - 1];
+		prewarmed.resize(prewarmed.size() - 1);
+		root_copy->initialize(p_agent, p_blackboard, scene_root);
+		return BTInstance::create(root_copy, behavior_tree->get_path(), p_instance_owner, uint64_t(behavior_tree->get_instance_id()));
+	}
+
+	return behavior_tree->instantiate(p_agent, p_blackboard, p_instance_owner, scene_root);
+}
+
+void BTInstancePool::release(const Ref<BTInstance> &p_instance) {
+	ERR_FAIL_COND(p_instance.is_null());
+	ERR_FAIL_COND_MSG(!p_instance->is_instance_valid(), "BTInstancePool: Can't release an invalid instance.");
+	ERR_FAIL_COND_MSG(behavior_tree.is_null() || p_instance->get_source_bt_id() != uint64_t(behavior_tree->get_instance_id()), "BTInstancePool: Instance wasn't created from this pool's BehaviorTree.");
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(released.has(p_instance), "BTInstancePool: Instance was already released.");
+#endif
+
+	p_instance->get_root_task()->abort();
+	p_instance->set_monitor_performance(false);
+	p_instance->unregister_with_debugger();
+	released.push_back(p_instance);
+}
+
+void BTInstancePool::clear() {
+	released.clear();
+	prewarmed.clear();
+}
+
+void BTInstancePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_behavior_tree", "behavior_tree"), &BTInstancePool::set_behavior_tree);
+	ClassDB::bind_method(D_METHOD("get_behavior_tree"), &BTInstancePool::get_behavior_tree);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &BTInstancePool::prewarm);
+	ClassDB::bind_method(D_METHOD("acquire", "agent", "blackboard", "instance_owner", "custom_scene_root"), &BTInstancePool::acquire, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("release", "instance"), &BTInstancePool::release);
+	ClassDB::bind_method(D_METHOD("clear"), &BTInstancePool::clear);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &BTInstancePool::get_available_count);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "behavior_tree", PROPERTY_HINT_RESOURCE_TYPE, "BehaviorTree"), "set_behavior_tree", "get_behavior_tree");
+}
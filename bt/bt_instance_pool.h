@@ -0,0 +1,58 @@
+/**
+ * bt_instance_pool.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef BT_INSTANCE_POOL_H
+#define BT_INSTANCE_POOL_H
+
+#include "behavior_tree.h"
+#include "bt_instance.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/templates/local_vector.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/templates/local_vector.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
+class BTInstancePool : public RefCounted {
+	GDCLASS(BTInstancePool, RefCounted);
+
+private:
+	Ref<BehaviorTree> behavior_tree;
+
+	// Instances returned to the pool. These are already initialized and are reset in place on acquire().
+	LocalVector<Ref<BTInstance>> released;
+	// Root tasks cloned ahead of time by prewarm(). These still need to be initialized.
+	LocalVector<Ref<BTTask>> prewarmed;
+
+protected:
+	static void _bind_methods();
+
+#ifdef LIMBOAI_GDEXTENSION
+	String _to_string() const { return "<" + get_class() + "#" + itos(get_instance_id()) + ">"; }
+#endif
+
+public:
+	void set_behavior_tree(const Ref<BehaviorTree> &p_behavior_tree);
+	Ref<BehaviorTree> get_behavior_tree() const { return behavior_tree; }
+
+	void prewarm(int p_count);
+	Ref<BTInstance> acquire(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node *p_instance_owner, Node *p_custom_scene_root = nullptr);
+	void release(const Ref<BTInstance> &p_instance);
+	void clear();
+
+	int get_available_count() const { return released.size() + prewarmed.size(); }
+
+	BTInstancePool() = default;
+};
+
+#endif // BT_INSTANCE_POOL_H
@@ -14,6 +14,7 @@
 #include "../compat/limbo_compat.h"
 #include "../compat/resource.h"
 #include "../util/limbo_string_names.h"
+#include "bt_scheduler.h"
 
 #ifdef LIMBOAI_MODULE
 #include "core/config/engine.h"
@@ -131,9 +132,26 @@ void BTPlayer::set_update_mode(UpdateMode p_mode) {
 void BTPlayer::set_active(bool p_active) {
 	active = p_active;
 	bool is_not_editor = !Engine::get_singleton()->is_editor_hint();
-	set_process(update_mode == UpdateMode::IDLE && active && is_not_editor);
-	set_physics_process(update_mode == UpdateMode::PHYSICS && active && is_not_editor);
+	bool use_scheduler = BTScheduler::get_singleton() && BTScheduler::get_singleton()->is_enabled();
+	set_process(update_mode == UpdateMode::IDLE && active && is_not_editor && !use_scheduler);
+	set_physics_process(update_mode == UpdateMode::PHYSICS && active && is_not_editor && !use_scheduler);
 	set_process_input(active && is_not_editor);
+	_update_scheduling();
+}
+
+void BTPlayer::_update_scheduling() {
+	BTScheduler *scheduler = BTScheduler::get_singleton();
+	if (scheduler == nullptr || !scheduler->is_enabled() || Engine::get_singleton()->is_editor_hint()) {
+		return;
+	}
+	bool should_schedule = active && update_mode != UpdateMode::MANUAL && is_inside_tree();
+	if (should_schedule && (!scheduled || scheduled_mode != update_mode)) {
+		scheduler->add_player(this, update_mode == UpdateMode::PHYSICS, lod_enabled);
+	} else if (!should_schedule && scheduled) {
+		scheduler->remove_client(this);
+	}
+	scheduled = should_schedule;
+	scheduled_mode = update_mode;
 }
 
 void BTPlayer::update(double p_delta) {
@@ -144,13 +162,17 @@ void BTPlayer::update(double p_delta) {
 
 	if (active) {
 		BT::Status status = bt_instance->update(p_delta);
-		emit_signal(LW_NAME(updated), status);
+		_emit_updated(status);
+	}
+}
+
+void BTPlayer::_emit_updated(BT::Status p_status) {
+	emit_signal(LW_NAME(updated), p_status);
 #ifndef DISABLE_DEPRECATED
-		if (status == BTTask::SUCCESS || status == BTTask::FAILURE) {
-			emit_signal(LW_NAME(behavior_tree_finished), status);
-		}
-#endif // DISABLE_DEPRECATED
+	if (p_status == BTTask::SUCCESS || p_status == BTTask::FAILURE) {
+		emit_signal(LW_NAME(behavior_tree_finished), p_status);
 	}
+#endif // DISABLE_DEPRECATED
 }
 
 void BTPlayer::restart() {
@@ -159,6 +181,13 @@ void BTPlayer::restart() {
 	set_active(true);
 }
 
+void BTPlayer::set_lod_enabled(bool p_lod_enabled) {
+	lod_enabled = p_lod_enabled;
+	if (scheduled) {
+		BTScheduler::get_singleton()->set_client_lod_enabled(this, lod_enabled);
+	}
+}
+
 void BTPlayer::set_monitor_performance(bool p_monitor_performance) {
 	monitor_performance = p_monitor_performance;
 
@@ -172,12 +201,10 @@ void BTPlayer::set_monitor_performance(bool p_monitor_performance) {
 void BTPlayer::_notification(int p_notification) {
 	switch (p_notification) {
 		case NOTIFICATION_PROCESS: {
-			Variant time = get_process_delta_time();
-			update(time);
+			update(get_process_delta_time());
 		} break;
 		case NOTIFICATION_PHYSICS_PROCESS: {
-			Variant time = get_physics_process_delta_time();
-			update(time);
+			update(get_physics_process_delta_time());
 		} break;
 		case NOTIFICATION_READY: {
 			if (!Engine::get_singleton()->is_editor_hint()) {
@@ -188,6 +215,7 @@ void BTPlayer::_notification(int p_notification) {
 			set_active(active);
 		} break;
 		case NOTIFICATION_ENTER_TREE: {
+			_update_scheduling();
 #ifdef DEBUG_ENABLED
 			if (bt_instance.is_valid()) {
 				bt_instance->set_monitor_performance(monitor_performance);
@@ -196,6 +224,10 @@ void BTPlayer::_notification(int p_notification) {
 #endif // DEBUG_ENABLED
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
+			if (scheduled) {
+				BTScheduler::get_singleton()->remove_client(this);
+				scheduled = false;
+			}
 #ifdef DEBUG_ENABLED
 			if (bt_instance.is_valid()) {
 				bt_instance->set_monitor_performance(false);
@@ -227,6 +259,8 @@ void BTPlayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_blackboard_plan", "plan"), &BTPlayer::set_blackboard_plan);
 	ClassDB::bind_method(D_METHOD("get_blackboard_plan"), &BTPlayer::get_blackboard_plan);
 
+	ClassDB::bind_method(D_METHOD("set_lod_enabled", "enable"), &BTPlayer::set_lod_enabled);
+	ClassDB::bind_method(D_METHOD("get_lod_enabled"), &BTPlayer::get_lod_enabled);
 	ClassDB::bind_method(D_METHOD("set_monitor_performance", "enable"), &BTPlayer::set_monitor_performance);
 	ClassDB::bind_method(D_METHOD("get_monitor_performance"), &BTPlayer::get_monitor_performance);
 
@@ -244,6 +278,7 @@ void BTPlayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "get_active");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "blackboard", PROPERTY_HINT_NONE, "Blackboard", 0), "set_blackboard", "get_blackboard");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "blackboard_plan", PROPERTY_HINT_RESOURCE_TYPE, "BlackboardPlan", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT | PROPERTY_USAGE_ALWAYS_DUPLICATE), "set_blackboard_plan", "get_blackboard_plan");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_enabled"), "set_lod_enabled", "get_lod_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "monitor_performance"), "set_monitor_performance", "get_monitor_performance");
 
 	BIND_ENUM_CONSTANT(IDLE);
@@ -263,4 +298,7 @@ BTPlayer::BTPlayer() {
 }
 
 BTPlayer::~BTPlayer() {
+	if (scheduled && BTScheduler::get_singleton()) {
+		BTScheduler::get_singleton()->remove_client(this);
+	}
 }
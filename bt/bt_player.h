@@ -28,6 +28,7 @@
 
 class BTPlayer : public Node {
 	GDCLASS(BTPlayer, Node);
+	friend class BTScheduler;
 
 public:
 	enum UpdateMode : unsigned int {
@@ -45,10 +46,15 @@ private:
 	Ref<Blackboard> blackboard;
 	Node *scene_root_hint = nullptr;
 	bool monitor_performance = false;
+	bool lod_enabled = false;
+	bool scheduled = false;
+	UpdateMode scheduled_mode = UpdateMode::PHYSICS;
 
 	Ref<BTInstance> bt_instance;
 
 	void _instantiate_bt();
+	void _update_scheduling();
+	void _emit_updated(BT::Status p_status);
 	void _update_blackboard_plan();
 	void _initialize();
 	_FORCE_INLINE_ Node *_get_scene_root() const { return scene_root_hint ? scene_root_hint : get_owner(); }
@@ -81,6 +87,9 @@ public:
 	Ref<Blackboard> get_blackboard() const { return blackboard; }
 	void set_blackboard(const Ref<Blackboard> &p_blackboard) { blackboard = p_blackboard; }
 
+	void set_lod_enabled(bool p_lod_enabled);
+	bool get_lod_enabled() const { return lod_enabled; }
+
 	void set_monitor_performance(bool p_monitor_performance);
 	bool get_monitor_performance() const { return monitor_performance; }
 
@@ -0,0 +1,587 @@
+/**
+ * bt_scheduler.cpp
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#include "bt_scheduler.h"
+
+#include "../compat/object.h"
+#include "../compat/project_settings.h"
+#include "../compat/scene_tree.h"
+#include "../hsm/limbo_hsm.h"
+#include "../util/limbo_string_names.h"
+#include "bt_player.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/os/time.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/classes/node2d.hpp>
+#include <godot_cpp/classes/node3d.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/window.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
+VARIANT_ENUM_CAST(BTScheduler::LODPolicy);
+
+//**** BTScheduler
+
+BTScheduler *BTScheduler::singleton = nullptr;
+
+BTScheduler::BTScheduler() {
+	singleton = this;
+	enabled = GLOBAL_DEF("limbo_ai/scheduler/enabled", false);
+	time_budget_usec = GLOBAL_DEF("limbo_ai/scheduler/time_budget_usec", 0);
+	lod_update_interval = GLOBAL_DEF("limbo_ai/scheduler/lod_update_interval", 0.25);
+	use_worker_threads = GLOBAL_DEF("limbo_ai/scheduler/use_worker_threads", false);
+}
+
+BTScheduler::~BTScheduler() {
+	singleton = nullptr;
+}
+
+void BTScheduler::_connect_to_scene_tree() {
+	SceneTree *tree = SCENE_TREE();
+	ERR_FAIL_NULL(tree);
+	if (connected_tree_id == uint64_t(tree->get_instance_id())) {
+		return;
+	}
+	tree->connect(LW_NAME(process_frame), callable_mp(this, &BTScheduler::_on_process_frame));
+	tree->connect(LW_NAME(physics_frame), callable_mp(this, &BTScheduler::_on_physics_frame));
+	connected_tree_id = tree->get_instance_id();
+}
+
+void BTScheduler::set_time_budget_usec(int p_time_budget_usec) {
+	ERR_FAIL_COND(p_time_budget_usec < 0);
+	time_budget_usec = p_time_budget_usec;
+}
+
+void BTScheduler::set_lod_policy(LODPolicy p_policy) {
+	lod_policy = p_policy;
+	_reset_lod(idle_clients);
+	_reset_lod(physics_clients);
+}
+
+void BTScheduler::set_lod_update_interval(double p_interval) {
+	ERR_FAIL_COND(p_interval < 0.0);
+	lod_update_interval = p_interval;
+}
+
+void BTScheduler::set_lod_reference_nodes(const TypedArray<Node> &p_nodes) {
+	lod_reference_ids.clear();
+	for (int i = 0; i < p_nodes.size(); i++) {
+		Node *node = Object::cast_to<Node>(p_nodes[i]);
+		ERR_CONTINUE(node == nullptr);
+		lod_reference_ids.push_back(uint64_t(node->get_instance_id()));
+	}
+}
+
+TypedArray<Node> BTScheduler::get_lod_reference_nodes() const {
+	TypedArray<Node> nodes;
+	for (uint32_t i = 0; i < lod_reference_ids.size(); i++) {
+		Node *node = Object::cast_to<Node>(OBJECT_DB_GET_INSTANCE(lod_reference_ids[i]));
+		if (node) {
+			nodes.push_back(node);
+		}
+	}
+	return nodes;
+}
+
+void BTScheduler::set_lod_distances(const PackedFloat32Array &p_distances) {
+	ERR_FAIL_COND_MSG(p_distances.size() > MAX_LOD_LEVEL, vformat("BTScheduler: At most %d LOD distances are supported.", MAX_LOD_LEVEL));
+	for (int i = 1; i < p_distances.size(); i++) {
+		ERR_FAIL_COND_MSG(p_distances[i] < p_distances[i - 1], "BTScheduler: LOD distances must be in ascending order.");
+	}
+	lod_distances = p_distances;
+}
+
+void BTScheduler::_add_client(Node *p_node, bool p_is_hsm, bool p_physics, bool p_lod_enabled) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(!enabled, "BTScheduler: Scheduler is disabled in the project settings.");
+	remove_client(p_node);
+	_connect_to_scene_tree();
+
+	ClientList &list = p_physics ? physics_clients : idle_clients;
+	Client client;
+	client.node = p_node;
+	client.is_hsm = p_is_hsm;
+	client.lod_enabled = p_lod_enabled;
+	// Stagger clients, so that clients with the same LOD level are not all updated on the same frame.
+	client.frames_pending = list.clients.size() % (1 << MAX_LOD_LEVEL);
+	list.clients.push_back(client);
+}
+
+void BTScheduler::add_player(BTPlayer *p_player, bool p_physics, bool p_lod_enabled) {
+	_add_client(p_player, false, p_physics, p_lod_enabled);
+}
+
+void BTScheduler::add_hsm(LimboHSM *p_hsm, bool p_physics, bool p_lod_enabled) {
+	_add_client(p_hsm, true, p_physics, p_lod_enabled);
+}
+
+BTScheduler::Client *BTScheduler::_find_client(Node *p_node) {
+	for (ClientList *list : { &idle_clients, &physics_clients }) {
+		for (uint32_t i = 0; i < list->clients.size(); i++) {
+			if (list->clients[i].node == p_node) {
+				return &list->clients[i];
+			}
+		}
+	}
+	return nullptr;
+}
+
+void BTScheduler::set_client_lod_enabled(Node *p_node, bool p_lod_enabled) {
+	Client *client = _find_client(p_node);
+	ERR_FAIL_NULL(client);
+	client->lod_enabled = p_lod_enabled;
+	if (!p_lod_enabled) {
+		client->lod_level = 0;
+	}
+}
+
+int BTScheduler::get_client_lod_level(Node *p_node) {
+	Client *client = _find_client(p_node);
+	ERR_FAIL_NULL_V(client, 0);
+	return client->lod_level;
+}
+
+bool BTScheduler::_remove_from(ClientList &p_list, Node *p_node) {
+	for (uint32_t i = 0; i < p_list.clients.size(); i++) {
+		if (p_list.clients[i].node == p_node) {
+			if (ticking) {
+				// Keep indices stable while iterating; compacted after the tick.
+				p_list.clients[i].node = nullptr;
+				has_removed_clients = true;
+			} else {
+				p_list.clients.remove_at(i);
+				if (p_list.cursor > i) {
+					p_list.cursor--;
+				}
+				if (p_list.threaded_cursor > i) {
+					p_list.threaded_cursor--;
+				}
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+void BTScheduler::remove_client(Node *p_node) {
+	if (!_remove_from(idle_clients, p_node)) {
+		_remove_from(physics_clients, p_node);
+	}
+}
+
+int BTScheduler::get_client_count() const {
+	return idle_clients.clients.size() + physics_clients.clients.size();
+}
+
+void BTScheduler::_compact_clients(ClientList &p_list) {
+	uint32_t w = 0;
+	uint32_t cursor = 0;
+	uint32_t threaded_cursor = 0;
+	for (uint32_t r = 0; r < p_list.clients.size(); r++) {
+		if (r == p_list.cursor) {
+			cursor = w;
+		}
+		if (r == p_list.threaded_cursor) {
+			threaded_cursor = w;
+		}
+		if (p_list.clients[r].node != nullptr) {
+			p_list.clients[w++] = p_list.clients[r];
+		}
+	}
+	p_list.clients.resize(w);
+	p_list.cursor = cursor;
+	p_list.threaded_cursor = threaded_cursor;
+}
+
+Node *BTScheduler::_get_client_agent(const Client &p_client) const {
+	Node *agent = nullptr;
+	if (p_client.is_hsm) {
+		agent = static_cast<LimboHSM *>(p_client.node)->get_agent();
+	} else {
+		Ref<BTInstance> bt_instance = static_cast<BTPlayer *>(p_client.node)->get_bt_instance();
+		if (bt_instance.is_valid()) {
+			agent = bt_instance->get_agent();
+		}
+	}
+	return agent ? agent : p_client.node;
+}
+
+void BTScheduler::_reset_lod(ClientList &p_list) {
+	for (uint32_t i = 0; i < p_list.clients.size(); i++) {
+		p_list.clients[i].lod_level = 0;
+	}
+	p_list.lod_timer = 0.0;
+}
+
+void BTScheduler::_evaluate_lod(ClientList &p_list) {
+	LocalVector<Client> &clients = p_list.clients;
+
+	switch (lod_policy) {
+		case LOD_POLICY_NONE: {
+		} break;
+		case LOD_POLICY_DISTANCE: {
+			// Gather reference positions once, then compare each agent against them.
+			LocalVector<Vector2> refs_2d;
+			LocalVector<Vector3> refs_3d;
+			for (uint32_t i = 0; i < lod_reference_ids.size(); i++) {
+				Object *obj = OBJECT_DB_GET_INSTANCE(lod_reference_ids[i]);
+				if (Node2D *node_2d = Object::cast_to<Node2D>(obj)) {
+					refs_2d.push_back(node_2d->get_global_position());
+				} else if (Node3D *node_3d = Object::cast_to<Node3D>(obj)) {
+					refs_3d.push_back(node_3d->get_global_position());
+				}
+			}
+			float thresholds_sq[MAX_LOD_LEVEL];
+			const int num_thresholds = lod_distances.size();
+			for (int i = 0; i < num_thresholds; i++) {
+				thresholds_sq[i] = lod_distances[i] * lod_distances[i];
+			}
+
+			for (uint32_t i = 0; i < clients.size(); i++) {
+				Client &client = clients[i];
+				if (client.node == nullptr || !client.lod_enabled) {
+					continue;
+				}
+				Node *agent = _get_client_agent(client);
+				float dist_sq = 0.0;
+				if (Node2D *agent_2d = Object::cast_to<Node2D>(agent)) {
+					if (refs_2d.size()) {
+						Vector2 pos = agent_2d->get_global_position();
+						dist_sq = pos.distance_squared_to(refs_2d[0]);
+						for (uint32_t r = 1; r < refs_2d.size(); r++) {
+							dist_sq = MIN(dist_sq, pos.distance_squared_to(refs_2d[r]));
+						}
+					}
+				} else if (Node3D *agent_3d = Object::cast_to<Node3D>(agent)) {
+					if (refs_3d.size()) {
+						Vector3 pos = agent_3d->get_global_position();
+						dist_sq = pos.distance_squared_to(refs_3d[0]);
+						for (uint32_t r = 1; r < refs_3d.size(); r++) {
+							dist_sq = MIN(dist_sq, pos.distance_squared_to(refs_3d[r]));
+						}
+					}
+				}
+				int level = 0;
+				while (level < num_thresholds && dist_sq > thresholds_sq[level]) {
+					level++;
+				}
+				client.lod_level = level;
+			}
+		} break;
+		case LOD_POLICY_VISIBILITY: {
+			for (uint32_t i = 0; i < clients.size(); i++) {
+				Client &client = clients[i];
+				if (client.node == nullptr || !client.lod_enabled) {
+					continue;
+				}
+				Node *agent = _get_client_agent(client);
+				bool visible = true;
+				if (CanvasItem *canvas_item = Object::cast_to<CanvasItem>(agent)) {
+					visible = canvas_item->is_visible_in_tree();
+				} else if (Node3D *node_3d = Object::cast_to<Node3D>(agent)) {
+					visible = node_3d->is_visible_in_tree();
+				}
+				client.lod_level = visible ? 0 : MAX_LOD_LEVEL;
+			}
+		} break;
+		case LOD_POLICY_CUSTOM: {
+			ERR_FAIL_COND_MSG(!lod_callback.is_valid(), "BTScheduler: LOD callback is not set.");
+			Array agents;
+			LocalVector<uint32_t> indices;
+			for (uint32_t i = 0; i < clients.size(); i++) {
+				if (clients[i].node && clients[i].lod_enabled) {
+					agents.push_back(_get_client_agent(clients[i]));
+					indices.push_back(i);
+				}
+			}
+			if (indices.is_empty()) {
+				return;
+			}
+			PackedInt32Array levels = lod_callback.call(agents);
+			ERR_FAIL_COND_MSG(levels.size() != (int)indices.size(), "BTScheduler: LOD callback must return one level per agent.");
+			for (uint32_t i = 0; i < indices.size(); i++) {
+				clients[indices[i]].lod_level = CLAMP(levels[i], 0, MAX_LOD_LEVEL);
+			}
+		} break;
+	}
+}
+
+void BTScheduler::_tick_threaded_job(uint32_t p_index) {
+	ThreadedJob &job = threaded_jobs[threaded_jobs_offset + p_index];
+	job.instance->tick(job.delta);
+}
+
+bool BTScheduler::_tick_threaded_clients(ClientList &p_list, uint64_t p_start_usec) {
+	// Thread-safe trees due for an update are executed on worker threads, in round-robin order from their own cursor.
+	// The rest are updated on the main thread afterwards. Returns true if the time budget is exhausted.
+	LocalVector<Client> &clients = p_list.clients;
+	const uint32_t count = clients.size();
+	for (uint32_t n = 0; n < count; n++) {
+		const uint32_t i = (p_list.threaded_cursor + n) % count;
+		Client &client = clients[i];
+		if (client.node == nullptr || client.is_hsm || !client.node->can_process() || client.frames_pending < (1u << client.lod_level)) {
+			continue;
+		}
+		BTPlayer *player = static_cast<BTPlayer *>(client.node);
+		Ref<BTInstance> bt_instance = player->get_bt_instance();
+		if (!player->get_active() || bt_instance.is_null() || !bt_instance->is_thread_safe()) {
+			continue;
+		}
+		ThreadedJob job;
+		job.instance = bt_instance;
+		job.player_id = uint64_t(player->get_instance_id());
+		job.client_idx = i;
+		threaded_jobs.push_back(job);
+	}
+
+	// With a time budget, jobs are executed in chunks of one job per processor, so that the budget can cut the batch short.
+	// Clients left out keep accumulating the delta, like those skipped on the main thread.
+	const uint32_t chunk_size = time_budget_usec > 0 ? (uint32_t)MAX(1, OS::get_singleton()->get_processor_count()) : threaded_jobs.size();
+	bool budget_exhausted = false;
+	uint32_t num_done = 0;
+	while (num_done < threaded_jobs.size() && !budget_exhausted) {
+		const uint32_t num_jobs = MIN(chunk_size, threaded_jobs.size() - num_done);
+		for (uint32_t i = num_done; i < num_done + num_jobs; i++) {
+			Client &client = clients[threaded_jobs[i].client_idx];
+			threaded_jobs[i].delta = client.pending_delta;
+			client.pending_delta = 0.0;
+			client.frames_pending = 0;
+		}
+		threaded_jobs_offset = num_done;
+		if (num_jobs == 1) {
+			_tick_threaded_job(0);
+		} else {
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(
+					callable_mp(this, &BTScheduler::_tick_threaded_job), num_jobs, -1, true, "BTScheduler");
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		}
+		num_done += num_jobs;
+		budget_exhausted = time_budget_usec > 0 && Time::get_singleton()->get_ticks_usec() - p_start_usec >= (uint64_t)time_budget_usec;
+	}
+	threaded_jobs_offset = 0;
+	if (budget_exhausted) {
+		// The round-robin continues after the last updated client next time.
+		p_list.threaded_cursor = (threaded_jobs[num_done - 1].client_idx + 1) % count;
+	}
+
+	// Signals are emitted on the main thread, once all trees in the batch are updated.
+	for (uint32_t i = 0; i < num_done; i++) {
+		const ThreadedJob &job = threaded_jobs[i];
+		BT::Status status = job.instance->get_last_status();
+		job.instance->dispatch_var_changes();
+		job.instance->emit_signal(LW_NAME(updated), status);
+		BTPlayer *player = Object::cast_to<BTPlayer>(OBJECT_DB_GET_INSTANCE(job.player_id));
+		if (player) {
+			player->_emit_updated(status);
+		}
+	}
+	threaded_jobs.clear();
+	return budget_exhausted;
+}
+
+void BTScheduler::_tick_clients(ClientList &p_list, double p_delta) {
+	LocalVector<Client> &clients = p_list.clients;
+	// Clients added during the tick are updated starting from the next frame.
+	const uint32_t count = clients.size();
+	if (p_list.cursor >= count) {
+		p_list.cursor = 0;
+	}
+	if (p_list.threaded_cursor >= count) {
+		p_list.threaded_cursor = 0;
+	}
+
+	if (lod_policy != LOD_POLICY_NONE) {
+		p_list.lod_timer -= p_delta;
+		if (p_list.lod_timer <= 0.0) {
+			_evaluate_lod(p_list);
+			p_list.lod_timer = lod_update_interval;
+		}
+	}
+
+	// Clients skipped due to LOD or the time budget accumulate the delta until they are updated.
+	for (uint32_t i = 0; i < count; i++) {
+		Client &client = clients[i];
+		if (client.node && client.node->can_process()) {
+			client.pending_delta += p_delta;
+			if (client.frames_pending < UINT8_MAX) {
+				client.frames_pending++;
+			}
+		}
+	}
+
+	ticking = true;
+	// Threaded and main thread updates share the time budget.
+	// Main thread clients have their own cursor, so they aren't starved when worker threads use up the budget.
+	const uint64_t start = Time::get_singleton()->get_ticks_usec();
+	const bool budget_exhausted = use_worker_threads && _tick_threaded_clients(p_list, start);
+
+	uint32_t idx = p_list.cursor;
+	for (uint32_t n = 0; n < count; n++) {
+		Client &client = clients[idx];
+		idx = (idx + 1) % count;
+		if (client.node == nullptr || !client.node->can_process() || client.frames_pending < (1u << client.lod_level)) {
+			continue;
+		}
+		double delta = client.pending_delta;
+		client.pending_delta = 0.0;
+		client.frames_pending = 0;
+		if (client.is_hsm) {
+			static_cast<LimboHSM *>(client.node)->_update(delta);
+		} else {
+			static_cast<BTPlayer *>(client.node)->update(delta);
+		}
+		if (budget_exhausted || (time_budget_usec > 0 && Time::get_singleton()->get_ticks_usec() - start >= (uint64_t)time_budget_usec)) {
+			// At least one client is always updated on the main thread, so the queue keeps moving.
+			break;
+		}
+	}
+	p_list.cursor = idx;
+	ticking = false;
+
+	if (has_removed_clients) {
+		_compact_clients(idle_clients);
+		_compact_clients(physics_clients);
+		has_removed_clients = false;
+	}
+}
+
+double BTScheduler::add_timeout(Object *p_object, double p_delay, bool p_process_in_pause, TimeoutCallback p_callback) {
+	ERR_FAIL_NULL_V(p_object, 0.0);
+	ERR_FAIL_NULL_V(p_callback, 0.0);
+	_connect_to_scene_tree();
+
+	TimeoutQueue &queue = p_process_in_pause ? pause_timeouts : timeouts;
+	Timeout timeout;
+	timeout.time = queue.clock + p_delay;
+	timeout.object_id = p_object->get_instance_id();
+	timeout.callback = p_callback;
+	_push_timeout(queue, timeout);
+	return timeout.time;
+}
+
+void BTScheduler::_push_timeout(TimeoutQueue &p_queue, const Timeout &p_timeout) {
+	LocalVector<Timeout> &heap = p_queue.heap;
+	uint32_t idx = heap.size();
+	heap.push_back(p_timeout);
+	while (idx > 0) {
+		uint32_t parent = (idx - 1) / 2;
+		if (heap[parent].time <= p_timeout.time) {
+			break;
+		}
+		heap[idx] = heap[parent];
+		idx = parent;
+	}
+	heap[idx] = p_timeout;
+}
+
+void BTScheduler::_advance_clock(TimeoutQueue &p_queue, double p_delta) {
+	p_queue.clock += p_delta;
+	LocalVector<Timeout> &heap = p_queue.heap;
+	while (!heap.is_empty() && heap[0].time <= p_queue.clock) {
+		const Timeout expired = heap[0];
+
+		// Pop the top: move the last element down from the root.
+		const Timeout last = heap[heap.size() - 1];
+		heap.resize(heap.size() - 1);
+		const uint32_t size = heap.size();
+		uint32_t idx = 0;
+		uint32_t child = 1;
+		while (child < size) {
+			if (child + 1 < size && heap[child + 1].time < heap[child].time) {
+				child++;
+			}
+			if (last.time <= heap[child].time) {
+				break;
+			}
+			heap[idx] = heap[child];
+			idx = child;
+			child = idx * 2 + 1;
+		}
+		if (size > 0) {
+			heap[idx] = last;
+		}
+
+		// Callback may add new timeouts, so it's called after the heap is consistent.
+		Object *obj = OBJECT_DB_GET_INSTANCE(expired.object_id);
+		if (obj) {
+			expired.callback(obj);
+		}
+	}
+}
+
+void BTScheduler::_process_frame(double p_delta, bool p_paused) {
+	if (!p_paused) {
+		_advance_clock(timeouts, p_delta);
+	}
+	_advance_clock(pause_timeouts, p_delta);
+
+	if (idle_clients.clients.size()) {
+		_tick_clients(idle_clients, p_delta);
+	}
+}
+
+void BTScheduler::_physics_frame(double p_delta) {
+	if (physics_clients.clients.size()) {
+		_tick_clients(physics_clients, p_delta);
+	}
+}
+
+void BTScheduler::_on_process_frame() {
+	_process_frame(SCENE_TREE()->get_root()->get_process_delta_time(), SCENE_TREE()->is_paused());
+}
+
+void BTScheduler::_on_physics_frame() {
+	_physics_frame(SCENE_TREE()->get_root()->get_physics_process_delta_time());
+}
+
+void BTScheduler::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("is_enabled"), &BTScheduler::is_enabled);
+	ClassDB::bind_method(D_METHOD("get_client_count"), &BTScheduler::get_client_count);
+	ClassDB::bind_method(D_METHOD("set_time_budget_usec", "time_budget_usec"), &BTScheduler::set_time_budget_usec);
+	ClassDB::bind_method(D_METHOD("get_time_budget_usec"), &BTScheduler::get_time_budget_usec);
+
+	ClassDB::bind_method(D_METHOD("set_use_worker_threads", "enable"), &BTScheduler::set_use_worker_threads);
+	ClassDB::bind_method(D_METHOD("get_use_worker_threads"), &BTScheduler::get_use_worker_threads);
+	ClassDB::bind_method(D_METHOD("set_lod_policy", "policy"), &BTScheduler::set_lod_policy);
+	ClassDB::bind_method(D_METHOD("get_lod_policy"), &BTScheduler::get_lod_policy);
+	ClassDB::bind_method(D_METHOD("set_lod_update_interval", "interval"), &BTScheduler::set_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval"), &BTScheduler::get_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_reference_nodes", "nodes"), &BTScheduler::set_lod_reference_nodes);
+	ClassDB::bind_method(D_METHOD("get_lod_reference_nodes"), &BTScheduler::get_lod_reference_nodes);
+	ClassDB::bind_method(D_METHOD("set_lod_distances", "distances"), &BTScheduler::set_lod_distances);
+	ClassDB::bind_method(D_METHOD("get_lod_distances"), &BTScheduler::get_lod_distances);
+	ClassDB::bind_method(D_METHOD("set_lod_callback", "callback"), &BTScheduler::set_lod_callback);
+	ClassDB::bind_method(D_METHOD("get_lod_callback"), &BTScheduler::get_lod_callback);
+	ClassDB::bind_method(D_METHOD("get_client_lod_level", "node"), &BTScheduler::get_client_lod_level);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "time_budget_usec", PROPERTY_HINT_RANGE, "0,100000,1,or_greater,suffix:usec"), "set_time_budget_usec", "get_time_budget_usec");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_worker_threads"), "set_use_worker_threads", "get_use_worker_threads");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_policy", PROPERTY_HINT_ENUM, "None,Distance,Visibility,Custom"), "set_lod_policy", "get_lod_policy");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_update_interval", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater,suffix:s"), "set_lod_update_interval", "get_lod_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "lod_reference_nodes", PROPERTY_HINT_ARRAY_TYPE, "Node"), "set_lod_reference_nodes", "get_lod_reference_nodes");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_FLOAT32_ARRAY, "lod_distances"), "set_lod_distances", "get_lod_distances");
+	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "lod_callback"), "set_lod_callback", "get_lod_callback");
+
+	BIND_ENUM_CONSTANT(LOD_POLICY_NONE);
+	BIND_ENUM_CONSTANT(LOD_POLICY_DISTANCE);
+	BIND_ENUM_CONSTANT(LOD_POLICY_VISIBILITY);
+	BIND_ENUM_CONSTANT(LOD_POLICY_CUSTOM);
+}
@@ -0,0 +1,186 @@
+/**
+ * bt_scheduler.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef BT_SCHEDULER_H
+#define BT_SCHEDULER_H
+
+#ifdef LIMBOAI_MODULE
+#include "core/object/class_db.h"
+#include "core/object/object.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/typed_array.h"
+#include "scene/main/node.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+using namespace godot;
+#endif // LIMBOAI_GDEXTENSION
+
+class BTInstance;
+class BTPlayer;
+class LimboHSM;
+
+// Updates BTPlayer and root LimboHSM nodes from a single SceneTree frame callback,
+// instead of dispatching process notifications to every node.
+// Enabled with the "limbo_ai/scheduler/enabled" project setting.
+// Also provides a game clock with timeouts for timed tasks, which is always available.
+class BTScheduler : public Object {
+	GDCLASS(BTScheduler, Object);
+
+public:
+	typedef void (*TimeoutCallback)(Object *p_object);
+
+	enum LODPolicy : unsigned int {
+		LOD_POLICY_NONE,
+		LOD_POLICY_DISTANCE,
+		LOD_POLICY_VISIBILITY,
+		LOD_POLICY_CUSTOM,
+	};
+
+	static constexpr int MAX_LOD_LEVEL = 3; // Updated at 1/8 rate.
+
+private:
+	struct Client {
+		Node *node = nullptr; // nullptr if removed while ticking.
+		bool is_hsm = false;
+		bool lod_enabled = false;
+		uint8_t lod_level = 0; // Client is updated every 2^lod_level frames.
+		uint8_t frames_pending = 0; // Frames accumulated since the client was last updated.
+		double pending_delta = 0.0; // Time accumulated since the client was last updated.
+	};
+
+	struct ClientList {
+		LocalVector<Client> clients;
+		uint32_t cursor = 0; // Client to update first on the main thread, when the time budget is limited.
+		uint32_t threaded_cursor = 0; // Client to update first on worker threads.
+		double lod_timer = 0.0;
+	};
+
+	struct Timeout {
+		double time = 0.0;
+		uint64_t object_id = 0;
+		TimeoutCallback callback = nullptr;
+	};
+
+	// Binary min-heap of timeouts ordered by time.
+	struct TimeoutQueue {
+		double clock = 0.0;
+		LocalVector<Timeout> heap;
+	};
+
+	struct ThreadedJob {
+		Ref<BTInstance> instance;
+		uint64_t player_id = 0;
+		uint32_t client_idx = 0;
+		double delta = 0.0;
+	};
+
+	static BTScheduler *singleton;
+
+	bool enabled = false;
+	bool ticking = false;
+	bool has_removed_clients = false;
+	int time_budget_usec = 0;
+	bool use_worker_threads = false;
+	uint64_t connected_tree_id = 0;
+
+	LODPolicy lod_policy = LOD_POLICY_NONE;
+	double lod_update_interval = 0.25;
+	LocalVector<uint64_t> lod_reference_ids;
+	PackedFloat32Array lod_distances;
+	Callable lod_callback;
+
+	LocalVector<ThreadedJob> threaded_jobs;
+	uint32_t threaded_jobs_offset = 0; // First job of the chunk being executed.
+
+	ClientList idle_clients;
+	ClientList physics_clients;
+
+	TimeoutQueue timeouts; // Advances while the scene tree is not paused.
+	TimeoutQueue pause_timeouts; // Advances always.
+
+	void _connect_to_scene_tree();
+	void _add_client(Node *p_node, bool p_is_hsm, bool p_physics, bool p_lod_enabled);
+	Client *_find_client(Node *p_node);
+	bool _remove_from(ClientList &p_list, Node *p_node);
+	Node *_get_client_agent(const Client &p_client) const;
+	void _evaluate_lod(ClientList &p_list);
+	void _reset_lod(ClientList &p_list);
+	void _tick_clients(ClientList &p_list, double p_delta);
+	bool _tick_threaded_clients(ClientList &p_list, uint64_t p_start_usec);
+	void _tick_threaded_job(uint32_t p_index);
+	void _compact_clients(ClientList &p_list);
+	void _push_timeout(TimeoutQueue &p_queue, const Timeout &p_timeout);
+	void _advance_clock(TimeoutQueue &p_queue, double p_delta);
+
+	void _process_frame(double p_delta, bool p_paused);
+	void _physics_frame(double p_delta);
+	void _on_process_frame();
+	void _on_physics_frame();
+
+protected:
+	static void _bind_methods();
+
+public:
+	_FORCE_INLINE_ static BTScheduler *get_singleton() { return singleton; }
+
+	_FORCE_INLINE_ bool is_enabled() const { return enabled; }
+
+	void set_time_budget_usec(int p_time_budget_usec);
+	int get_time_budget_usec() const { return time_budget_usec; }
+
+	void set_use_worker_threads(bool p_use_worker_threads) { use_worker_threads = p_use_worker_threads; }
+	bool get_use_worker_threads() const { return use_worker_threads; }
+
+	void set_lod_policy(LODPolicy p_policy);
+	LODPolicy get_lod_policy() const { return lod_policy; }
+
+	void set_lod_update_interval(double p_interval);
+	double get_lod_update_interval() const { return lod_update_interval; }
+
+	void set_lod_reference_nodes(const TypedArray<Node> &p_nodes);
+	TypedArray<Node> get_lod_reference_nodes() const;
+
+	void set_lod_distances(const PackedFloat32Array &p_distances);
+	PackedFloat32Array get_lod_distances() const { return lod_distances; }
+
+	void set_lod_callback(const Callable &p_callback) { lod_callback = p_callback; }
+	Callable get_lod_callback() const { return lod_callback; }
+
+	void add_player(BTPlayer *p_player, bool p_physics, bool p_lod_enabled);
+	void add_hsm(LimboHSM *p_hsm, bool p_physics, bool p_lod_enabled);
+	void remove_client(Node *p_node);
+	void set_client_lod_enabled(Node *p_node, bool p_lod_enabled);
+	int get_client_lod_level(Node *p_node);
+
+	int get_client_count() const;
+
+	// * Game clock in seconds: scaled by time scale, and optionally stopped while the scene tree is paused.
+	_FORCE_INLINE_ double get_clock(bool p_process_in_pause) const { return p_process_in_pause ? pause_timeouts.clock : timeouts.clock; }
+	// Calls p_callback with p_object after p_delay seconds, if the object is still alive. Returns the clock time of the timeout.
+	double add_timeout(Object *p_object, double p_delay, bool p_process_in_pause, TimeoutCallback p_callback);
+
+#ifdef TESTS_ENABLED
+	// * Unit tests enable the scheduler without the project setting, and run frames with a fixed delta.
+	void set_enabled_for_tests(bool p_enabled) { enabled = p_enabled; }
+	void process_frame_for_tests(double p_delta, bool p_paused = false) { _process_frame(p_delta, p_paused); }
+	void physics_frame_for_tests(double p_delta) { _physics_frame(p_delta); }
+#endif // TESTS_ENABLED
+
+	BTScheduler();
+	~BTScheduler();
+};
+
+#endif // BT_SCHEDULER_H
@@ -0,0 +1,873 @@
+/**
+ * bt_check_condition.cpp
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#include "bt_check_condition.h"
+
+namespace {
+
+_FORCE_INLINE_ bool _is_digit(char32_t c) {
+	return c >= '0' && c <= '9';
+}
+
+_FORCE_INLINE_ bool _is_identifier_start(char32_t c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+_FORCE_INLINE_ bool _is_identifier_char(char32_t c) {
+	return _is_identifier_start(c) || _is_digit(c);
+}
+
+_FORCE_INLINE_ bool _is_comparison(Variant::Operator p_op) {
+	return p_op == Variant::OP_EQUAL || p_op == Variant::OP_NOT_EQUAL ||
+			p_op == Variant::OP_LESS || p_op == Variant::OP_LESS_EQUAL ||
+			p_op == Variant::OP_GREATER || p_op == Variant::OP_GREATER_EQUAL;
+}
+
+_FORCE_INLINE_ bool _is_float_arithmetic(Variant::Operator p_op) {
+	return p_op == Variant::OP_ADD || p_op == Variant::OP_SUBTRACT ||
+			p_op == Variant::OP_MULTIPLY || p_op == Variant::OP_DIVIDE;
+}
+
+_FORCE_INLINE_ bool _is_numeric(Variant::Type p_type) {
+	return p_type == Variant::INT || p_type == Variant::FLOAT;
+}
+
+template <typename T>
+_FORCE_INLINE_ bool _compare(Variant::Operator p_op, T a, T b) {
+	switch (p_op) {
+		case Variant::OP_EQUAL:
+			return a == b;
+		case Variant::OP_NOT_EQUAL:
+			return a != b;
+		case Variant::OP_LESS:
+			return a < b;
+		case Variant::OP_LESS_EQUAL:
+			return a <= b;
+		case Variant::OP_GREATER:
+			return a > b;
+		case Variant::OP_GREATER_EQUAL:
+			return a >= b;
+		default:
+			return false;
+	}
+}
+
+// Returns false if the operation should be handled by Variant::evaluate() instead.
+bool _evaluate_int(Variant::Operator p_op, int64_t a, int64_t b, Variant &r_ret) {
+	switch (p_op) {
+		case Variant::OP_ADD: {
+			r_ret = a + b;
+		} break;
+		case Variant::OP_SUBTRACT: {
+			r_ret = a - b;
+		} break;
+		case Variant::OP_MULTIPLY: {
+			r_ret = a * b;
+		} break;
+		case Variant::OP_DIVIDE: {
+			if (unlikely(b == 0)) {
+				return false;
+			}
+			r_ret = a / b;
+		} break;
+		case Variant::OP_MODULE: {
+			if (unlikely(b == 0)) {
+				return false;
+			}
+			r_ret = a % b;
+		} break;
+		default: {
+			r_ret = _compare(p_op, a, b);
+		} break;
+	}
+	return true;
+}
+
+void _evaluate_float(Variant::Operator p_op, double a, double b, Variant &r_ret) {
+	switch (p_op) {
+		case Variant::OP_ADD: {
+			r_ret = a + b;
+		} break;
+		case Variant::OP_SUBTRACT: {
+			r_ret = a - b;
+		} break;
+		case Variant::OP_MULTIPLY: {
+			r_ret = a * b;
+		} break;
+		case Variant::OP_DIVIDE: {
+			r_ret = a / b;
+		} break;
+		default: {
+			r_ret = _compare(p_op, a, b);
+		} break;
+	}
+}
+
+} //namespace
+
+//**** Compiler
+
+// Recursive descent compiler with GDScript operator precedence:
+//     or:          and ( ("||" | "or") and )*
+//     and:         not ( ("&&" | "and") not )*
+//     not:         ("!" | "not") not | comparison
+//     comparison:  additive ( ("==" | "!=" | "<" | "<=" | ">" | ">=") additive )?
+//     additive:    term ( ("+" | "-") term )*
+//     term:        unary ( ("*" | "/" | "%") unary )*
+//     unary:       "-" unary | primary
+//     primary:     number | string | "true" | "false" | "null" | $variable | property | "(" or ")"
+// Operations on constants are folded at compile time.
+struct BTCheckCondition::Compiler {
+	enum TokenType {
+		TK_EOF,
+		TK_ERROR,
+		TK_CONSTANT,
+		TK_VARIABLE,
+		TK_PROPERTY,
+		TK_OR,
+		TK_AND,
+		TK_NOT,
+		TK_COMPARISON,
+		TK_PLUS,
+		TK_MINUS,
+		TK_STAR,
+		TK_SLASH,
+		TK_PERCENT,
+		TK_PAREN_OPEN,
+		TK_PAREN_CLOSE,
+	};
+
+	struct Token {
+		TokenType type = TK_EOF;
+		Variant value;
+		String name;
+		Variant::Operator op = Variant::OP_EQUAL;
+		int column = 0;
+	};
+
+	static constexpr uint32_t NO_INSTRUCTION = UINT32_MAX;
+
+	Program *program = nullptr;
+	String source;
+	int pos = 0;
+	Token token;
+	String error;
+
+	uint32_t depth = 0;
+	uint32_t max_depth = 0;
+	uint32_t last_start = NO_INSTRUCTION; // Start of the last emitted instruction.
+	uint32_t prev_start = NO_INSTRUCTION; // Start of the instruction before the last one.
+	uint32_t jump_barrier = 0; // Instructions before a jump target can't be folded.
+
+	bool _error(const String &p_message) {
+		if (error.is_empty()) {
+			error = vformat("%s at column %d.", p_message, token.column + 1);
+		}
+		token.type = TK_ERROR;
+		return false;
+	}
+
+	void _scan_token();
+	_FORCE_INLINE_ bool _next() {
+		_scan_token();
+		return token.type != TK_ERROR;
+	}
+
+	void _emit(uint32_t p_opcode) {
+		prev_start = last_start;
+		last_start = program->code.size();
+		program->code.push_back(p_opcode);
+	}
+
+	void _emit(uint32_t p_opcode, uint32_t p_operand) {
+		_emit(p_opcode);
+		program->code.push_back(p_operand);
+	}
+
+	void _grow() {
+		depth++;
+		max_depth = MAX(max_depth, depth);
+	}
+
+	_FORCE_INLINE_ bool _is_constant_at(uint32_t p_start) const {
+		return p_start != NO_INSTRUCTION && p_start >= jump_barrier && program->code[p_start] == OP_PUSH_CONSTANT;
+	}
+
+	void _emit_constant(const Variant &p_value) {
+		program->constants.push_back(p_value);
+		_emit(OP_PUSH_CONSTANT, program->constants.size() - 1);
+		_grow();
+	}
+
+	void _emit_var(const StringName &p_name) {
+		int64_t idx = program->var_names.find(p_name);
+		if (idx == -1) {
+			idx = program->var_names.size();
+			program->var_names.push_back(p_name);
+		}
+		_emit(OP_PUSH_VAR, idx);
+		_grow();
+	}
+
+	void _emit_property(const StringName &p_name) {
+		int64_t idx = program->properties.find(p_name);
+		if (idx == -1) {
+			idx = program->properties.size();
+			program->properties.push_back(p_name);
+		}
+		_emit(OP_PUSH_PROPERTY, idx);
+		_grow();
+	}
+
+	void _emit_unary(Opcode p_opcode) {
+		if (_is_constant_at(last_start) && last_start + 2 == program->code.size()) {
+			Variant &value = program->constants[program->code[last_start + 1]];
+			if (p_opcode == OP_NOT) {
+				value = !value.booleanize();
+				return;
+			} else if (p_opcode == OP_TO_BOOL) {
+				value = value.booleanize();
+				return;
+			} else if (p_opcode == OP_NEGATE) {
+				Variant ret;
+				bool valid = false;
+				Variant::evaluate(Variant::OP_NEGATE, value, Variant(), ret, valid);
+				if (valid) {
+					value = ret;
+					return;
+				}
+			}
+		}
+		_emit(p_opcode);
+	}
+
+	void _emit_binary(Variant::Operator p_op) {
+		if (_is_constant_at(prev_start) && _is_constant_at(last_start) &&
+				last_start == prev_start + 2 && last_start + 2 == program->code.size()) {
+			Variant ret;
+			bool valid = false;
+			Variant::evaluate(p_op, program->constants[program->code[prev_start + 1]], program->constants[program->code[last_start + 1]], ret, valid);
+			if (valid) {
+				// * Both operands are the most recent constants.
+				program->code.resize(prev_start);
+				program->constants.resize(program->constants.size() - 2);
+				last_start = NO_INSTRUCTION;
+				prev_start = NO_INSTRUCTION;
+				depth -= 2;
+				_emit_constant(ret);
+				return;
+			}
+		}
+		_emit(OP_BINARY, p_op);
+		program->code.push_back(program->num_binary_ops++);
+		depth--;
+	}
+
+	// Emits a conditional jump and returns position of its operand for patching.
+	uint32_t _emit_jump(Opcode p_opcode) {
+		_emit(p_opcode, 0);
+		depth--; // Value is popped when not jumping.
+		return program->code.size() - 1;
+	}
+
+	void _patch_jump(uint32_t p_operand_pos) {
+		program->code[p_operand_pos] = program->code.size();
+		jump_barrier = program->code.size();
+	}
+
+	bool _parse_or();
+	bool _parse_and();
+	bool _parse_not();
+	bool _parse_comparison();
+	bool _parse_additive();
+	bool _parse_term();
+	bool _parse_unary();
+	bool _parse_primary();
+
+	bool compile() {
+		if (!_next()) {
+			return false;
+		}
+		if (!_parse_or()) {
+			return false;
+		}
+		if (token.type != TK_EOF) {
+			return _error("Unexpected token");
+		}
+		program->stack_size = max_depth;
+		return true;
+	}
+
+	Compiler(Program *p_program, const String &p_source) :
+			program(p_program), source(p_source) {}
+};
+
+void BTCheckCondition::Compiler::_scan_token() {
+	const int length = source.length();
+	while (pos < length && (source[pos] == ' ' || source[pos] == '\t' || source[pos] == '\n' || source[pos] == '\r')) {
+		pos++;
+	}
+
+	token = Token();
+	token.column = pos;
+	if (pos >= length) {
+		token.type = TK_EOF;
+		return;
+	}
+
+	const char32_t c = source[pos];
+	const char32_t next = pos + 1 < length ? source[pos + 1] : 0;
+
+	if (_is_digit(c) || (c == '.' && _is_digit(next))) {
+		const int start = pos;
+		bool is_float = false;
+		while (pos < length && _is_digit(source[pos])) {
+			pos++;
+		}
+		if (pos < length && source[pos] == '.') {
+			is_float = true;
+			pos++;
+			while (pos < length && _is_digit(source[pos])) {
+				pos++;
+			}
+		}
+		if (pos < length && (source[pos] == 'e' || source[pos] == 'E')) {
+			is_float = true;
+			pos++;
+			if (pos < length && (source[pos] == '+' || source[pos] == '-')) {
+				pos++;
+			}
+			while (pos < length && _is_digit(source[pos])) {
+				pos++;
+			}
+		}
+		const String number = source.substr(start, pos - start);
+		token.type = TK_CONSTANT;
+		token.value = is_float ? Variant(number.to_float()) : Variant(number.to_int());
+		return;
+	}
+
+	if (c == '"' || c == '\'') {
+		pos++;
+		String str;
+		while (pos < length && source[pos] != c) {
+			char32_t ch = source[pos];
+			if (ch == '\\' && pos + 1 < length) {
+				pos++;
+				ch = source[pos];
+				if (ch == 'n') {
+					ch = '\n';
+				} else if (ch == 't') {
+					ch = '\t';
+				}
+			}
+			str += String::chr(ch);
+			pos++;
+		}
+		if (pos >= length) {
+			_error("Unterminated string");
+			return;
+		}
+		pos++;
+		token.type = TK_CONSTANT;
+		token.value = str;
+		return;
+	}
+
+	if (c == '$' || _is_identifier_start(c)) {
+		const int start = c == '$' ? pos + 1 : pos;
+		pos = start;
+		while (pos < length && _is_identifier_char(source[pos])) {
+			pos++;
+		}
+		const String name = source.substr(start, pos - start);
+		if (c == '$') {
+			if (name.is_empty()) {
+				_error("Expected variable name after \"$\"");
+				return;
+			}
+			token.type = TK_VARIABLE;
+			token.name = name;
+		} else if (name == "true" || name == "false") {
+			token.type = TK_CONSTANT;
+			token.value = name == "true";
+		} else if (name == "null") {
+			token.type = TK_CONSTANT;
+		} else if (name == "and") {
+			token.type = TK_AND;
+		} else if (name == "or") {
+			token.type = TK_OR;
+		} else if (name == "not") {
+			token.type = TK_NOT;
+		} else {
+			token.type = TK_PROPERTY;
+			token.name = name;
+		}
+		return;
+	}
+
+	pos++;
+	switch (c) {
+		case '|':
+		case '&': {
+			if (next != c) {
+				_error(vformat("Unexpected character \"%s\"", String::chr(c)));
+				return;
+			}
+			pos++;
+			token.type = c == '|' ? TK_OR : TK_AND;
+		} break;
+		case '=': {
+			if (next != '=') {
+				_error("Unexpected character \"=\"");
+				return;
+			}
+			pos++;
+			token.type = TK_COMPARISON;
+			token.op = Variant::OP_EQUAL;
+		} break;
+		case '!': {
+			if (next == '=') {
+				pos++;
+				token.type = TK_COMPARISON;
+				token.op = Variant::OP_NOT_EQUAL;
+			} else {
+				token.type = TK_NOT;
+			}
+		} break;
+		case '<':
+		case '>': {
+			token.type = TK_COMPARISON;
+			if (next == '=') {
+				pos++;
+				token.op = c == '<' ? Variant::OP_LESS_EQUAL : Variant::OP_GREATER_EQUAL;
+			} else {
+				token.op = c == '<' ? Variant::OP_LESS : Variant::OP_GREATER;
+			}
+		} break;
+		case '+': {
+			token.type = TK_PLUS;
+		} break;
+		case '-': {
+			token.type = TK_MINUS;
+		} break;
+		case '*': {
+			token.type = TK_STAR;
+		} break;
+		case '/': {
+			token.type = TK_SLASH;
+		} break;
+		case '%': {
+			token.type = TK_PERCENT;
+		} break;
+		case '(': {
+			token.type = TK_PAREN_OPEN;
+		} break;
+		case ')': {
+			token.type = TK_PAREN_CLOSE;
+		} break;
+		default: {
+			_error(vformat("Unexpected character \"%s\"", String::chr(c)));
+		} break;
+	}
+}
+
+bool BTCheckCondition::Compiler::_parse_or() {
+	if (!_parse_and()) {
+		return false;
+	}
+	while (token.type == TK_OR) {
+		if (!_next()) {
+			return false;
+		}
+		_emit_unary(OP_TO_BOOL);
+		uint32_t jump = _emit_jump(OP_JUMP_IF_TRUE);
+		if (!_parse_and()) {
+			return false;
+		}
+		_emit_unary(OP_TO_BOOL);
+		_patch_jump(jump);
+	}
+	return true;
+}
+
+bool BTCheckCondition::Compiler::_parse_and() {
+	if (!_parse_not()) {
+		return false;
+	}
+	while (token.type == TK_AND) {
+		if (!_next()) {
+			return false;
+		}
+		_emit_unary(OP_TO_BOOL);
+		uint32_t jump = _emit_jump(OP_JUMP_IF_FALSE);
+		if (!_parse_not()) {
+			return false;
+		}
+		_emit_unary(OP_TO_BOOL);
+		_patch_jump(jump);
+	}
+	return true;
+}
+
+bool BTCheckCondition::Compiler::_parse_not() {
+	// As in GDScript, negation applies to the whole comparison: "not $a == 1" is "not ($a == 1)".
+	if (token.type == TK_NOT) {
+		if (!_next() || !_parse_not()) {
+			return false;
+		}
+		_emit_unary(OP_NOT);
+		return true;
+	}
+	return _parse_comparison();
+}
+
+bool BTCheckCondition::Compiler::_parse_comparison() {
+	if (!_parse_additive()) {
+		return false;
+	}
+	if (token.type == TK_COMPARISON) {
+		const Variant::Operator op = token.op;
+		if (!_next() || !_parse_additive()) {
+			return false;
+		}
+		_emit_binary(op);
+	}
+	return true;
+}
+
+bool BTCheckCondition::Compiler::_parse_additive() {
+	if (!_parse_term()) {
+		return false;
+	}
+	while (token.type == TK_PLUS || token.type == TK_MINUS) {
+		const Variant::Operator op = token.type == TK_PLUS ? Variant::OP_ADD : Variant::OP_SUBTRACT;
+		if (!_next() || !_parse_term()) {
+			return false;
+		}
+		_emit_binary(op);
+	}
+	return true;
+}
+
+bool BTCheckCondition::Compiler::_parse_term() {
+	if (!_parse_unary()) {
+		return false;
+	}
+	while (token.type == TK_STAR || token.type == TK_SLASH || token.type == TK_PERCENT) {
+		const Variant::Operator op = token.type == TK_STAR ? Variant::OP_MULTIPLY : (token.type == TK_SLASH ? Variant::OP_DIVIDE : Variant::OP_MODULE);
+		if (!_next() || !_parse_unary()) {
+			return false;
+		}
+		_emit_binary(op);
+	}
+	return true;
+}
+
+bool BTCheckCondition::Compiler::_parse_unary() {
+	if (token.type == TK_MINUS) {
+		if (!_next() || !_parse_unary()) {
+			return false;
+		}
+		_emit_unary(OP_NEGATE);
+		return true;
+	}
+	return _parse_primary();
+}
+
+bool BTCheckCondition::Compiler::_parse_primary() {
+	switch (token.type) {
+		case TK_CONSTANT: {
+			_emit_constant(token.value);
+		} break;
+		case TK_VARIABLE: {
+			_emit_var(token.name);
+		} break;
+		case TK_PROPERTY: {
+			_emit_property(token.name);
+		} break;
+		case TK_PAREN_OPEN: {
+			if (!_next() || !_parse_or()) {
+				return false;
+			}
+			if (token.type != TK_PAREN_CLOSE) {
+				return _error("Expected \")\"");
+			}
+		} break;
+		case TK_ERROR: {
+			return false;
+		} break;
+		default: {
+			return _error("Expected a value");
+		} break;
+	}
+	return _next();
+}
+
+//**** Setters / Getters
+
+void BTCheckCondition::set_condition(const String &p_condition) {
+	if (condition != p_condition) {
+		_release_program(); // Compiled on first use.
+	}
+	condition = p_condition;
+	emit_changed();
+}
+
+bool BTCheckCondition::is_condition_valid() const {
+	const Program *prog = _get_program();
+	return prog->error.is_empty() && !prog->code.is_empty();
+}
+
+//**** Task Implementation
+
+const BTCheckCondition::Program *BTCheckCondition::_get_program() const {
+	if (likely(program)) {
+		return program;
+	}
+	program = memnew(Program);
+	program->refcount.init();
+	if (!condition.strip_edges().is_empty()) {
+		Compiler compiler(program, condition);
+		if (!compiler.compile()) {
+			program->error = compiler.error;
+			program->code.clear();
+		}
+	}
+	return program;
+}
+
+void BTCheckCondition::_release_program() {
+	if (program && program->refcount.unref()) {
+		memdelete(program);
+	}
+	program = nullptr;
+	// * A new program may be allocated at the same address, so execution state is prepared again.
+	prepared_program = nullptr;
+}
+
+Ref<BTTask> BTCheckCondition::clone() const {
+	// Clones share the compiled program instead of compiling the same condition again.
+	Ref<BTCheckCondition> inst = BTCondition::clone();
+	if (inst->condition == condition && inst->program == nullptr) {
+		Program *prog = const_cast<Program *>(_get_program());
+		if (prog->refcount.ref()) {
+			inst->program = prog;
+		}
+	}
+	return inst;
+}
+
+void BTCheckCondition::_prepare_execution() {
+	const Program *prog = _get_program();
+	var_handles.resize(prog->var_names.size());
+	for (uint32_t i = 0; i < var_handles.size(); i++) {
+		var_handles[i] = get_blackboard()->resolve_var(prog->var_names[i]);
+	}
+	binary_kinds.resize(prog->num_binary_ops);
+	for (uint32_t i = 0; i < binary_kinds.size(); i++) {
+		binary_kinds[i] = BINARY_GENERIC;
+	}
+	stack.resize(prog->stack_size);
+	prepared_program = prog;
+}
+
+BTCheckCondition::BinaryKind BTCheckCondition::_specialize_binary(Variant::Operator p_op, const Variant &p_a, const Variant &p_b) {
+	const Variant::Type type_a = p_a.get_type();
+	const Variant::Type type_b = p_b.get_type();
+	if (type_a == Variant::INT && type_b == Variant::INT) {
+		if ((p_op == Variant::OP_DIVIDE || p_op == Variant::OP_MODULE) && int64_t(p_b) == 0) {
+			return BINARY_GENERIC; // Reported by Variant::evaluate().
+		}
+		return BINARY_INT;
+	}
+	if (_is_numeric(type_a) && _is_numeric(type_b) && (_is_float_arithmetic(p_op) || _is_comparison(p_op))) {
+		return BINARY_FLOAT;
+	}
+	if (type_a == Variant::BOOL && type_b == Variant::BOOL && (p_op == Variant::OP_EQUAL || p_op == Variant::OP_NOT_EQUAL)) {
+		return BINARY_BOOL;
+	}
+	return BINARY_GENERIC;
+}
+
+bool BTCheckCondition::_execute_code(const Program *p_program, Variant &r_result) {
+	const Ref<Blackboard> blackboard = get_blackboard();
+	const LocalVector<uint32_t> &code = p_program->code;
+	const uint32_t code_size = code.size();
+	uint32_t pc = 0;
+	uint32_t sp = 0;
+
+	while (pc < code_size) {
+		switch (code[pc]) {
+			case OP_PUSH_CONSTANT: {
+				stack[sp++] = p_program->constants[code[pc + 1]];
+				pc += 2;
+			} break;
+			case OP_PUSH_VAR: {
+				BBVarHandle &handle = var_handles[code[pc + 1]];
+				ERR_FAIL_COND_V_MSG(!blackboard->has_var_by_handle(handle), false, vformat("BTCheckCondition: Blackboard variable doesn't exist: \"%s\".", handle.name));
+				stack[sp++] = handle.var.get_value();
+				pc += 2;
+			} break;
+			case OP_PUSH_PROPERTY: {
+				const StringName &property = p_program->properties[code[pc + 1]];
+#ifdef LIMBOAI_MODULE
+				bool valid = false;
+				stack[sp++] = get_agent()->get(property, &valid);
+				ERR_FAIL_COND_V_MSG(!valid, false, vformat("BTCheckCondition: Agent has no property named \"%s\".", property));
+#elif LIMBOAI_GDEXTENSION
+				stack[sp++] = get_agent()->get(property);
+#endif
+				pc += 2;
+			} break;
+			case OP_NOT: {
+				stack[sp - 1] = !stack[sp - 1].booleanize();
+				pc += 1;
+			} break;
+			case OP_NEGATE: {
+				Variant &value = stack[sp - 1];
+				if (value.get_type() == Variant::INT) {
+					value = -int64_t(value);
+				} else if (value.get_type() == Variant::FLOAT) {
+					value = -double(value);
+				} else {
+					Variant ret;
+					bool valid = false;
+					Variant::evaluate(Variant::OP_NEGATE, value, Variant(), ret, valid);
+					ERR_FAIL_COND_V_MSG(!valid, false, "BTCheckCondition: Invalid operand for unary minus: " + Variant::get_type_name(value.get_type()) + ".");
+					value = ret;
+				}
+				pc += 1;
+			} break;
+			case OP_TO_BOOL: {
+				if (stack[sp - 1].get_type() != Variant::BOOL) {
+					stack[sp - 1] = stack[sp - 1].booleanize();
+				}
+				pc += 1;
+			} break;
+			case OP_JUMP_IF_FALSE: {
+				if (!stack[sp - 1].booleanize()) {
+					pc = code[pc + 1];
+				} else {
+					sp--;
+					pc += 2;
+				}
+			} break;
+			case OP_JUMP_IF_TRUE: {
+				if (stack[sp - 1].booleanize()) {
+					pc = code[pc + 1];
+				} else {
+					sp--;
+					pc += 2;
+				}
+			} break;
+			case OP_BINARY: {
+				const Variant::Operator op = Variant::Operator(code[pc + 1]);
+				BinaryKind &kind = binary_kinds[code[pc + 2]];
+				Variant &a = stack[sp - 2];
+				const Variant &b = stack[sp - 1];
+				bool done = false;
+				switch (kind) {
+					case BINARY_INT: {
+						done = likely(a.get_type() == Variant::INT && b.get_type() == Variant::INT) && _evaluate_int(op, a, b, a);
+					} break;
+					case BINARY_FLOAT: {
+						if (likely(_is_numeric(a.get_type()) && _is_numeric(b.get_type()) && (a.get_type() == Variant::FLOAT || b.get_type() == Variant::FLOAT))) {
+							_evaluate_float(op, a, b, a);
+							done = true;
+						}
+					} break;
+					case BINARY_BOOL: {
+						if (likely(a.get_type() == Variant::BOOL && b.get_type() == Variant::BOOL)) {
+							a = _compare(op, bool(a), bool(b));
+							done = true;
+						}
+					} break;
+					case BINARY_GENERIC: {
+					} break;
+				}
+				if (unlikely(!done)) {
+					// Specialized on first use, or when operand types change; the instruction is then retried.
+					BinaryKind specialized = _specialize_binary(op, a, b);
+					if (specialized != kind) {
+						kind = specialized;
+						if (specialized != BINARY_GENERIC) {
+							break;
+						}
+					}
+					Variant ret;
+					bool valid = false;
+					Variant::evaluate(op, a, b, ret, valid);
+					ERR_FAIL_COND_V_MSG(!valid, false, vformat("BTCheckCondition: Invalid operands for operator: %s and %s.", Variant::get_type_name(a.get_type()), Variant::get_type_name(b.get_type())));
+					a = ret;
+				}
+				sp--;
+				pc += 3;
+			} break;
+			default: {
+				ERR_FAIL_V_MSG(false, "BTCheckCondition: Invalid opcode.");
+			} break;
+		}
+	}
+
+	r_result = stack[0];
+	return true;
+}
+
+PackedStringArray BTCheckCondition::get_configuration_warnings() {
+	PackedStringArray warnings = BTCondition::get_configuration_warnings();
+	if (condition.strip_edges().is_empty()) {
+		warnings.append("`condition` should be assigned.");
+	} else if (!_get_program()->error.is_empty()) {
+		warnings.append("Condition error: " + _get_program()->error);
+	}
+	return warnings;
+}
+
+String BTCheckCondition::_generate_name() {
+	if (condition.strip_edges().is_empty()) {
+		return "CheckCondition ???";
+	}
+	return "Check if: " + condition.strip_edges();
+}
+
+void BTCheckCondition::_setup() {
+	_prepare_execution();
+}
+
+BT::Status BTCheckCondition::_tick(double p_delta) {
+	const Program *prog = _get_program();
+	ERR_FAIL_COND_V_MSG(!prog->error.is_empty(), FAILURE, "BTCheckCondition: " + prog->error);
+	ERR_FAIL_COND_V_MSG(prog->code.is_empty(), FAILURE, "BTCheckCondition: `condition` is not set.");
+	if (unlikely(prepared_program != prog)) {
+		_prepare_execution(); // Condition was changed after setup.
+	}
+
+	Variant result;
+	if (!_execute_code(prog, result)) {
+		return FAILURE;
+	}
+	return result.booleanize() ? SUCCESS : FAILURE;
+}
+
+BTCheckCondition::~BTCheckCondition() {
+	_release_program();
+}
+
+//**** Godot
+
+void BTCheckCondition::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_condition", "condition"), &BTCheckCondition::set_condition);
+	ClassDB::bind_method(D_METHOD("get_condition"), &BTCheckCondition::get_condition);
+	ClassDB::bind_method(D_METHOD("is_condition_valid"), &BTCheckCondition::is_condition_valid);
+
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "condition", PROPERTY_HINT_PLACEHOLDER_TEXT, "$hp > 0 && not $is_stunned"), "set_condition", "get_condition");
+}
@@ -0,0 +1,104 @@
+/**
+ * bt_check_condition.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef BT_CHECK_CONDITION_H
+#define BT_CHECK_CONDITION_H
+
+#include "../bt_condition.h"
+
+#include "../../../blackboard/blackboard.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
+class BTCheckCondition : public BTCondition {
+	GDCLASS(BTCheckCondition, BTCondition);
+	TASK_CATEGORY(Blackboard);
+
+private:
+	// Condition is compiled into bytecode for a small stack machine.
+	// Each instruction is an opcode, optionally followed by operands.
+	enum Opcode : uint32_t {
+		OP_PUSH_CONSTANT, // operand: index in constants
+		OP_PUSH_VAR, // operand: index in var_names
+		OP_PUSH_PROPERTY, // operand: index in properties
+		OP_NOT,
+		OP_NEGATE,
+		OP_TO_BOOL,
+		OP_JUMP_IF_FALSE, // operand: target; pops the value unless jumping
+		OP_JUMP_IF_TRUE, // operand: target; pops the value unless jumping
+		OP_BINARY, // operands: Variant::Operator, index in binary_kinds
+	};
+
+	// Operand types seen by a binary operation, specialized on first use in each task instance.
+	enum BinaryKind : uint8_t {
+		BINARY_GENERIC,
+		BINARY_INT,
+		BINARY_FLOAT,
+		BINARY_BOOL,
+	};
+
+	// Compiled condition. Immutable once compiled, and shared between the clones of a task.
+	struct Program {
+		SafeRefCount refcount;
+		LocalVector<uint32_t> code;
+		LocalVector<Variant> constants;
+		LocalVector<StringName> properties;
+		LocalVector<StringName> var_names;
+		uint32_t stack_size = 0;
+		uint32_t num_binary_ops = 0;
+		String error;
+	};
+
+	struct Compiler;
+
+	String condition;
+	mutable Program *program = nullptr; // Compiled on first use.
+
+	// Execution state of this instance.
+	const Program *prepared_program = nullptr;
+	LocalVector<BBVarHandle> var_handles;
+	LocalVector<BinaryKind> binary_kinds;
+	LocalVector<Variant> stack;
+
+	const Program *_get_program() const;
+	void _release_program();
+	void _prepare_execution();
+	bool _execute_code(const Program *p_program, Variant &r_result);
+	static BinaryKind _specialize_binary(Variant::Operator p_op, const Variant &p_a, const Variant &p_b);
+
+protected:
+	static void _bind_methods();
+
+	virtual String _generate_name() override;
+	virtual void _setup() override;
+	virtual Status _tick(double p_delta) override;
+
+public:
+	virtual PackedStringArray get_configuration_warnings() override;
+	virtual Ref<BTTask> clone() const override;
+
+	void set_condition(const String &p_condition);
+	String get_condition() const { return condition; }
+
+	bool is_condition_valid() const;
+
+	~BTCheckCondition();
+};
+
+#endif // BT_CHECK_CONDITION_H
@@ -21,10 +21,13 @@ class BTCheckTrigger : public BTCondition {
 private:
 	StringName variable;
 
+	BBVarHandle var_handle;
+
 protected:
 	static void _bind_methods();
 
 	virtual String _generate_name() override;
+	virtual void _setup() override;
 	virtual Status _tick(double p_delta) override;
 
 public:
@@ -23,11 +23,13 @@
 
 void BTCheckVar::set_variable(const StringName &p_variable) {
 	variable = p_variable;
+	var_handle.reset(variable);
 	emit_changed();
 }
 
 void BTCheckVar::set_check_type(LimboUtility::CheckType p_check_type) {
 	check_type = p_check_type;
+	check_evaluator = LimboUtility::OperatorEvaluator();
 	emit_changed();
 }
 
@@ -61,16 +63,25 @@ String BTCheckVar::_generate_name() {
 			value.is_valid() ? Variant(value) : Variant("???"));
 }
 
+void BTCheckVar::_setup() {
+	var_handle = get_blackboard()->resolve_var(variable);
+	if (value.is_valid()) {
+		value_handle = value->resolve(get_blackboard());
+		Variant::Type var_type = get_blackboard()->has_var_by_handle(var_handle) ? var_handle.var.get_type() : Variant::NIL;
+		check_evaluator = LimboUtility::get_singleton()->get_check_evaluator(check_type, var_type, value->get_declared_type(get_blackboard(), value_handle));
+	}
+}
+
 BT::Status BTCheckVar::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(variable == StringName(), FAILURE, "BTCheckVar: `variable` is not set.");
 	ERR_FAIL_COND_V_MSG(!value.is_valid(), FAILURE, "BTCheckVar: `value` is not set.");
 
-	ERR_FAIL_COND_V_MSG(!get_blackboard()->has_var(variable), FAILURE, vformat("BTCheckVar: Blackboard variable doesn't exist: \"%s\". Returning FAILURE.", variable));
+	ERR_FAIL_COND_V_MSG(!get_blackboard()->has_var_by_handle(var_handle), FAILURE, vformat("BTCheckVar: Blackboard variable doesn't exist: \"%s\". Returning FAILURE.", variable));
 
-	Variant left_value = get_blackboard()->get_var(variable, Variant());
-	Variant right_value = value->get_value(get_scene_root(), get_blackboard());
+	Variant left_value = get_blackboard()->get_var_by_handle(var_handle, Variant());
+	Variant right_value = value->get_value_by_handle(get_scene_root(), get_blackboard(), value_handle);
 
-	return LimboUtility::get_singleton()->perform_check(check_type, left_value, right_value) ? SUCCESS : FAILURE;
+	return LimboUtility::get_singleton()->perform_check_with_evaluator(check_type, check_evaluator, left_value, right_value) ? SUCCESS : FAILURE;
 }
 
 void BTCheckVar::_bind_methods() {
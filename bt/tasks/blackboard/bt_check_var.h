@@ -26,10 +26,15 @@ private:
 	LimboUtility::CheckType check_type = LimboUtility::CheckType::CHECK_EQUAL;
 	Ref<BBVariant> value;
 
+	BBVarHandle var_handle;
+	BBParamHandle value_handle;
+	LimboUtility::OperatorEvaluator check_evaluator;
+
 protected:
 	static void _bind_methods();
 
 	virtual String _generate_name() override;
+	virtual void _setup() override;
 	virtual Status _tick(double p_delta) override;
 
 public:
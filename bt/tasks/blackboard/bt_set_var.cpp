@@ -31,27 +31,39 @@ String BTSetVar::_generate_name() {
 			value.is_valid() ? Variant(value) : Variant("???"));
 }
 
+void BTSetVar::_setup() {
+	var_handle = get_blackboard()->resolve_var(variable);
+	if (value.is_valid()) {
+		value_handle = value->resolve(get_blackboard());
+		if (operation != LimboUtility::OPERATION_NONE) {
+			Variant::Type var_type = get_blackboard()->has_var_by_handle(var_handle) ? var_handle.var.get_type() : Variant::NIL;
+			operation_evaluator = LimboUtility::get_singleton()->get_operation_evaluator(operation, var_type, value->get_declared_type(get_blackboard(), value_handle));
+		}
+	}
+}
+
 BT::Status BTSetVar::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(variable == StringName(), FAILURE, "BTSetVar: `variable` is not set.");
 	ERR_FAIL_COND_V_MSG(!value.is_valid(), FAILURE, "BTSetVar: `value` is not set.");
 	Variant result;
 	Variant error_result = LW_NAME(error_value);
-	Variant right_value = value->get_value(get_scene_root(), get_blackboard(), error_result);
+	Variant right_value = value->get_value_by_handle(get_scene_root(), get_blackboard(), value_handle, error_result);
 	ERR_FAIL_COND_V_MSG(right_value == error_result, FAILURE, "BTSetVar: Failed to get parameter value. Returning FAILURE.");
 	if (operation == LimboUtility::OPERATION_NONE) {
 		result = right_value;
 	} else if (operation != LimboUtility::OPERATION_NONE) {
-		Variant left_value = get_blackboard()->get_var(variable, error_result);
+		Variant left_value = get_blackboard()->get_var_by_handle(var_handle, error_result);
 		ERR_FAIL_COND_V_MSG(left_value == error_result, FAILURE, vformat("BTSetVar: Failed to get \"%s\" blackboard variable. Returning FAILURE.", variable));
-		result = LimboUtility::get_singleton()->perform_operation(operation, left_value, right_value);
+		result = LimboUtility::get_singleton()->perform_operation_with_evaluator(operation, operation_evaluator, left_value, right_value);
 		ERR_FAIL_COND_V_MSG(result == Variant(), FAILURE, "BTSetVar: Operation not valid. Returning FAILURE.");
 	}
-	get_blackboard()->set_var(variable, result);
+	get_blackboard()->set_var_by_handle(var_handle, result);
 	return SUCCESS;
 };
 
 void BTSetVar::set_variable(const StringName &p_variable) {
 	variable = p_variable;
+	var_handle.reset(variable);
 	emit_changed();
 }
 
@@ -66,6 +78,7 @@ void BTSetVar::set_value(const Ref<BBVariant> &p_value) {
 
 void BTSetVar::set_operation(LimboUtility::Operation p_operation) {
 	operation = p_operation;
+	operation_evaluator = LimboUtility::OperatorEvaluator();
 	emit_changed();
 }
 
@@ -26,10 +26,15 @@ private:
 	Ref<BBVariant> value;
 	LimboUtility::Operation operation = LimboUtility::OPERATION_NONE;
 
+	BBVarHandle var_handle;
+	BBParamHandle value_handle;
+	LimboUtility::OperatorEvaluator operation_evaluator;
+
 protected:
 	static void _bind_methods();
 
 	virtual String _generate_name() override;
+	virtual void _setup() override;
 	virtual Status _tick(double p_delta) override;
 
 public:
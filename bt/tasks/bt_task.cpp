@@ -103,6 +103,15 @@ void BTTask::_set_children(Array p_children) {
 	if (num_null > 0) {
 		data.children.resize(num_children - num_null);
 	}
+	_structure_changed();
+}
+
+void BTTask::_structure_changed() {
+	BTTask *root = this;
+	while (root->data.parent != nullptr) {
+		root = root->data.parent;
+	}
+	root->data.tree_revision += 1;
 }
 
 void BTTask::set_enabled(bool p_enabled) {
@@ -181,13 +190,15 @@ void BTTask::initialize(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node
 	data.blackboard = p_blackboard;
 	data.scene_root = p_scene_root;
 	for (int i = 0; i < data.children.size(); i++) {
-		get_child(i)->initialize(p_agent, p_blackboard, p_scene_root);
+		get_child_ptr(i)->initialize(p_agent, p_blackboard, p_scene_root);
 	}
 
 	_setup();
 	GDVIRTUAL_CALL(_setup);
 }
 
+bool BTTask::share_bb_params = false;
+
 Ref<BTTask> BTTask::clone() const {
 	if (!data.enabled && !Engine::get_singleton()->is_editor_hint()) {
 		return nullptr;
@@ -197,6 +208,12 @@ Ref<BTTask> BTTask::clone() const {
 
 	// * Children are duplicated via children property. See _set_children().
 
+	if (share_bb_params && !Engine::get_singleton()->is_editor_hint()) {
+		// * When enabled in project settings, BBParam resources are treated as read-only configuration
+		// * and shared between all instances of a behavior tree, which makes instantiation much cheaper.
+		return inst;
+	}
+
 	// * Make BBParam properties unique.
 	HashMap<Ref<Resource>, Ref<Resource>> duplicates;
 #ifdef LIMBOAI_MODULE
@@ -257,6 +274,7 @@ BT::Status BTTask::execute(double p_delta) {
 		data.elapsed += p_delta;
 	}
 
+	data.sleep_time = -1.0;
 	if (!GDVIRTUAL_CALL(_tick, p_delta, data.status)) {
 		data.status = _tick(p_delta);
 	}
@@ -270,9 +288,19 @@ BT::Status BTTask::execute(double p_delta) {
 	return data.status;
 }
 
+void BTTask::_save_task_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	_save_state(p_stream);
+	GDVIRTUAL_CALL(_save_state, p_stream);
+}
+
+void BTTask::_load_task_state(const Ref<StreamPeerBuffer> &p_stream) {
+	_load_state(p_stream);
+	GDVIRTUAL_CALL(_load_state, p_stream);
+}
+
 void BTTask::abort() {
 	for (int i = 0; i < data.children.size(); i++) {
-		get_child(i)->abort();
+		get_child_ptr(i)->abort();
 	}
 	if (data.status == RUNNING) {
 		// First script, then native.
@@ -283,6 +311,36 @@ void BTTask::abort() {
 	data.elapsed = 0.0;
 }
 
+void BTTask::request_sleep(double p_duration, const StringName &p_wake_var) {
+	ERR_FAIL_COND(p_duration < 0.0);
+	data.sleep_time = p_duration;
+	data.wake_var = p_wake_var;
+}
+
+BTTask *BTTask::_find_sleeping_task(BTTask *p_task) {
+	BTTask *task = p_task;
+	while (task->data.sleep_time < 0.0) {
+		if (!task->_propagates_sleep()) {
+			return nullptr;
+		}
+		BTTask *running_child = nullptr;
+		for (int i = 0; i < task->get_child_count(); i++) {
+			BTTask *child = task->get_child_ptr(i);
+			if (child->get_status() == BT::RUNNING) {
+				if (running_child) {
+					return nullptr;
+				}
+				running_child = child;
+			}
+		}
+		if (running_child == nullptr) {
+			return nullptr;
+		}
+		task = running_child;
+	}
+	return task;
+}
+
 int BTTask::get_enabled_child_count() const {
 	int count = 0;
 	for (int i = 0; i < data.children.size(); i++) {
@@ -298,6 +356,7 @@ void BTTask::add_child(Ref<BTTask> p_child) {
 	p_child->data.parent = this;
 	p_child->data.index = data.children.size();
 	data.children.push_back(p_child);
+	_structure_changed();
 	emit_changed();
 }
 
@@ -312,6 +371,7 @@ void BTTask::add_child_at_index(Ref<BTTask> p_child, int p_idx) {
 	for (int i = p_idx + 1; i < data.children.size(); i++) {
 		get_child(i)->data.index = i;
 	}
+	_structure_changed();
 	emit_changed();
 }
 
@@ -324,6 +384,7 @@ void BTTask::remove_child(Ref<BTTask> p_child) {
 	for (int i = idx; i < data.children.size(); i++) {
 		get_child(i)->data.index = i;
 	}
+	_structure_changed();
 	emit_changed();
 }
 
@@ -335,6 +396,7 @@ void BTTask::remove_child_at_index(int p_idx) {
 	for (int i = p_idx; i < data.children.size(); i++) {
 		get_child(i)->data.index = i;
 	}
+	_structure_changed();
 	emit_changed();
 }
 
@@ -431,6 +493,7 @@ void BTTask::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("print_tree", "initial_tabs"), &BTTask::print_tree, Variant(0));
 	ClassDB::bind_method(D_METHOD("get_task_name"), &BTTask::get_task_name);
 	ClassDB::bind_method(D_METHOD("abort"), &BTTask::abort);
+	ClassDB::bind_method(D_METHOD("request_sleep", "duration", "wake_var"), &BTTask::request_sleep, DEFVAL(StringName()));
 	ClassDB::bind_method(D_METHOD("editor_get_behavior_tree"), &BTTask::editor_get_behavior_tree);
 
 #ifndef DISABLE_DEPRECATED
@@ -470,6 +533,8 @@ void BTTask::_bind_methods() {
 	GDVIRTUAL_BIND(_tick, "delta");
 	GDVIRTUAL_BIND(_generate_name);
 	GDVIRTUAL_BIND(_get_configuration_warnings);
+	GDVIRTUAL_BIND(_save_state, "stream");
+	GDVIRTUAL_BIND(_load_state, "stream");
 }
 
 BTTask::BTTask() {
@@ -17,6 +17,7 @@
 
 #ifdef LIMBOAI_MODULE
 #include "core/io/resource.h"
+#include "core/io/stream_peer.h"
 #include "core/object/object.h"
 #include "core/templates/vector.h"
 #include "scene/main/node.h"
@@ -25,6 +26,7 @@
 #ifdef LIMBOAI_GDEXTENSION
 #include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/classes/stream_peer_buffer.hpp>
 #include <godot_cpp/core/gdvirtual.gen.inc>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/templates/vector.hpp>
@@ -60,6 +62,11 @@ class BTTask : public BT {
 
 private:
 	friend class BehaviorTree;
+	friend class BTInstance;
+	friend class BTParallel;
+
+	// Opt-in: share BBParam resources between runtime clones instead of duplicating them.
+	static bool share_bb_params;
 
 	// Avoid namespace pollution in the derived classes.
 	struct Data {
@@ -72,6 +79,9 @@ private:
 		Vector<Ref<BTTask>> children;
 		Status status = FRESH;
 		double elapsed = 0.0;
+		double sleep_time = -1.0; // Requested during the last tick; negative if none.
+		StringName wake_var;
+		uint32_t tree_revision = 0; // Incremented on the root task on any structural change within the tree.
 		bool display_collapsed = false;
 		bool enabled = true;
 #ifdef TOOLS_ENABLED
@@ -88,6 +98,7 @@ protected:
 	static void _bind_methods();
 
 	void _set_enabled(bool p_enabled) { data.enabled = p_enabled; }
+	void _structure_changed();
 	void _emit_branch_changed();
 
 	virtual String _generate_name();
@@ -96,12 +107,31 @@ protected:
 	virtual void _exit() {}
 	virtual Status _tick(double p_delta) { return FAILURE; }
 
+	// Returns true if, while a child is running, this task does nothing but execute that child.
+	// Sleep requested by the running child then puts the whole instance to sleep.
+	virtual bool _propagates_sleep() const { return false; }
+
+	// Follows the running path from p_task while each task only forwards ticks to its running child.
+	// Returns the task at the end of that path that requested sleep during the last tick, or nullptr.
+	static BTTask *_find_sleeping_task(BTTask *p_task);
+
+	// Runtime state not covered by status and elapsed time, saved with BTInstance::save_state().
+	// Restored tasks are not re-entered, so _load_state() must restore what _enter() would set up.
+	virtual void _save_state(const Ref<StreamPeerBuffer> &p_stream) const {}
+	virtual void _load_state(const Ref<StreamPeerBuffer> &p_stream) {}
+
+	// Native state first, then script state.
+	void _save_task_state(const Ref<StreamPeerBuffer> &p_stream) const;
+	void _load_task_state(const Ref<StreamPeerBuffer> &p_stream);
+
 	GDVIRTUAL0RC(String, _generate_name);
 	GDVIRTUAL0(_setup);
 	GDVIRTUAL0(_enter);
 	GDVIRTUAL0(_exit);
 	GDVIRTUAL1R(Status, _tick, double);
 	GDVIRTUAL0RC(PackedStringArray, _get_configuration_warnings);
+	GDVIRTUAL1C(_save_state, Ref<StreamPeerBuffer>);
+	GDVIRTUAL1(_load_state, Ref<StreamPeerBuffer>);
 
 #ifdef LIMBOAI_GDEXTENSION
 	String _to_string() const { return "<" + get_class() + "#" + itos(get_instance_id()) + ">"; }
@@ -134,12 +164,16 @@ public:
 	Ref<BTTask> get_root() const;
 
 	virtual Ref<BTTask> clone() const;
+	static void set_share_bb_params(bool p_share) { share_bb_params = p_share; }
+	static bool is_sharing_bb_params() { return share_bb_params; }
 	virtual void initialize(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node *p_scene_root);
 	virtual PackedStringArray get_configuration_warnings(); // ! Native version.
 
 	Status execute(double p_delta);
 	void abort();
 
+	void request_sleep(double p_duration, const StringName &p_wake_var = StringName());
+
 	_FORCE_INLINE_ Ref<BTTask> get_parent() const { return Ref<BTTask>(data.parent); }
 	_FORCE_INLINE_ bool is_root() const { return data.parent == nullptr; }
 	_FORCE_INLINE_ Ref<Blackboard> get_blackboard() const { return data.blackboard; }
@@ -151,6 +185,12 @@ public:
 		return data.children.get(p_idx);
 	}
 
+	// Fast path for native composites and decorators: avoids Ref copies in hot loops.
+	_FORCE_INLINE_ BTTask *get_child_ptr(int p_idx) const {
+		DEV_ASSERT(p_idx >= 0 && p_idx < data.children.size());
+		return data.children[p_idx].ptr();
+	}
+
 	_FORCE_INLINE_ int get_child_count() const { return data.children.size(); }
 	int get_enabled_child_count() const;
 
@@ -19,16 +19,24 @@ BT::Status BTDynamicSequence::_tick(double p_delta) {
 	Status status = SUCCESS;
 	int i;
 	for (i = 0; i < get_child_count(); i++) {
-		status = get_child(i)->execute(p_delta);
+		status = get_child_ptr(i)->execute(p_delta);
 		if (status != SUCCESS) {
 			break;
 		}
 	}
 	// If the last node ticked is earlier in the tree than the previous runner,
 	// cancel previous runner.
-	if (last_running_idx > i && get_child(last_running_idx)->get_status() == RUNNING) {
-		get_child(last_running_idx)->abort();
+	if (last_running_idx > i && get_child_ptr(last_running_idx)->get_status() == RUNNING) {
+		get_child_ptr(last_running_idx)->abort();
 	}
 	last_running_idx = i;
 	return status;
 }
+
+void BTDynamicSequence::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_32(last_running_idx);
+}
+
+void BTDynamicSequence::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	last_running_idx = CLAMP(p_stream->get_32(), 0, MAX(0, get_child_count() - 1));
+}
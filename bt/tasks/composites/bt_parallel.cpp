@@ -11,40 +11,253 @@
 
 #include "bt_parallel.h"
 
-void BTParallel::_enter() {
-	for (int i = 0; i < get_child_count(); i++) {
-		get_child(i)->abort();
+#include "../../bt_instance.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
+namespace {
+
+_FORCE_INLINE_ bool _is_main_thread() {
+#ifdef LIMBOAI_MODULE
+	return Thread::get_caller_id() == Thread::get_main_id();
+#elif LIMBOAI_GDEXTENSION
+	return OS::get_singleton()->get_thread_caller_id() == OS::get_singleton()->get_main_thread_id();
+#endif
+}
+
+} //namespace
+
+bool BTParallel::_is_subtree_thread_safe(BTTask *p_task) {
+	// Siblings share the blackboard, so only tasks that never write to it may run concurrently.
+	if (p_task->get_script().get_type() != Variant::NIL || !LimboTaskDB::is_task_pure(p_task->get_class()) ||
+			BTInstance::has_node_params(p_task)) {
+		return false;
+	}
+	for (int i = 0; i < p_task->get_child_count(); i++) {
+		if (!_is_subtree_thread_safe(p_task->get_child_ptr(i))) {
+			return false;
+		}
 	}
+	return true;
 }
 
-BT::Status BTParallel::_tick(double p_delta) {
-	int num_succeeded = 0;
-	int num_failed = 0;
-	BT::Status return_status = RUNNING;
-	for (int i = 0; i < get_child_count(); i++) {
-		Status status = BT::FRESH;
-		Ref<BTTask> child = get_child(i);
-		if (!repeat && (child->get_status() == FAILURE || child->get_status() == SUCCESS)) {
-			status = child->get_status();
+void BTParallel::_rebuild_active_children() {
+	// When not repeating, finished children keep their status until the parallel is re-entered.
+	active_children.clear();
+	num_succeeded = 0;
+	num_failed = 0;
+	num_children = get_child_count();
+	for (int i = 0; i < num_children; i++) {
+		BTTask *child = get_child_ptr(i);
+		Status status = child->get_status();
+		if (!repeat && status == SUCCESS) {
+			num_succeeded += 1;
+		} else if (!repeat && status == FAILURE) {
+			num_failed += 1;
 		} else {
-			status = child->execute(p_delta);
+			ActiveChild entry;
+			entry.task = child;
+			entry.status = status;
+			active_children.push_back(entry);
+		}
+	}
+	active_dirty = false;
+}
+
+bool BTParallel::_is_child_asleep(ActiveChild &p_child) const {
+	if (p_child.sleep_time < 0.0 || p_child.pending_delta >= p_child.sleep_time || p_child.task->get_status() != RUNNING) {
+		return false;
+	}
+	if (p_child.has_wake_var) {
+		if (p_child.wake_blackboard->get_var_version_by_handle(p_child.wake_var) != p_child.wake_var_version) {
+			return false;
 		}
+		// Bound properties can change without writing to the variable.
+		if (p_child.wake_var.found && p_child.wake_var.var.is_bound() && p_child.wake_var.var.get_value() != p_child.wake_var_value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void BTParallel::_track_child_sleep(ActiveChild &p_child) {
+	p_child.pending_delta = 0.0;
+	p_child.sleep_time = -1.0;
+	if (p_child.has_wake_var) {
+		p_child.has_wake_var = false;
+		p_child.wake_var = BBVarHandle();
+		p_child.wake_var_value = Variant();
+		p_child.wake_blackboard.unref();
+	}
+	if (p_child.status != RUNNING) {
+		return;
+	}
+
+	BTTask *sleeping = BTTask::_find_sleeping_task(p_child.task);
+	if (sleeping == nullptr) {
+		return;
+	}
+	p_child.sleep_time = sleeping->data.sleep_time;
+	p_child.has_wake_var = sleeping->data.wake_var != StringName();
+	if (p_child.has_wake_var) {
+		p_child.wake_blackboard = sleeping->get_blackboard();
+		p_child.wake_var = p_child.wake_blackboard->resolve_var(sleeping->data.wake_var);
+		p_child.wake_var_version = p_child.wake_blackboard->get_var_version_by_handle(p_child.wake_var);
+		if (p_child.wake_var.found && p_child.wake_var.var.is_bound()) {
+			p_child.wake_var_value = p_child.wake_var.var.get_value();
+		}
+	}
+}
+
+void BTParallel::_execute_threaded_child(uint32_t p_index) {
+	ActiveChild &entry = active_children[threaded_queue[p_index]];
+	entry.status = entry.task->execute(entry.pending_delta);
+}
+
+BT::Status BTParallel::_get_status_in_child_order() const {
+	// Resolves which requirement is met first, as if all children were ticked in order.
+	int succeeded = 0;
+	int failed = 0;
+	for (int i = 0; i < get_child_count(); i++) {
+		Status status = get_child_ptr(i)->get_status();
 		if (status == FAILURE) {
-			num_failed += 1;
-			if (num_failed >= num_failures_required && return_status == RUNNING) {
-				return_status = FAILURE;
+			failed += 1;
+			if (failed >= num_failures_required) {
+				return FAILURE;
 			}
 		} else if (status == SUCCESS) {
-			num_succeeded += 1;
-			if (num_succeeded >= num_successes_required && return_status == RUNNING) {
-				return_status = SUCCESS;
+			succeeded += 1;
+			if (succeeded >= num_successes_required) {
+				return SUCCESS;
 			}
 		}
 	}
-	if (!repeat && (num_failed + num_succeeded) == get_child_count() && return_status == RUNNING) {
-		return_status = FAILURE;
+	return RUNNING;
+}
+
+bool BTParallel::_is_blackboard_thread_safe() {
+	// Bound variables call into nodes, and bindings can change at any time, so the blackboard is checked whenever its layout changes.
+	const Ref<Blackboard> &bb = get_blackboard();
+	if (bb.is_null()) {
+		return false;
+	}
+	if (blackboard_epoch != bb->get_layout_epoch()) {
+		blackboard_thread_safe = bb->get_parent().is_null() && !bb->has_external_vars();
+		blackboard_epoch = bb->get_layout_epoch();
+	}
+	return blackboard_thread_safe;
+}
+
+void BTParallel::_setup() {
+	threaded_supported = true;
+	for (int i = 0; threaded_supported && i < get_child_count(); i++) {
+		threaded_supported = _is_subtree_thread_safe(get_child_ptr(i));
+	}
+	blackboard_epoch = 0;
+	active_dirty = true;
+}
+
+void BTParallel::_enter() {
+	for (int i = 0; i < get_child_count(); i++) {
+		get_child_ptr(i)->abort();
+	}
+	active_dirty = true;
+}
+
+BT::Status BTParallel::_tick(double p_delta) {
+	if (active_dirty || num_children != get_child_count()) {
+		_rebuild_active_children();
+	}
+
+	// Only children that can change their status are executed; sleeping children are skipped until they wake.
+	// Waiting for a group task from a worker thread can deadlock the pool, so off the main thread children are executed sequentially.
+	const bool use_threads = run_threaded && threaded_supported && _is_main_thread() && _is_blackboard_thread_safe();
+	for (uint32_t i = 0; i < active_children.size(); i++) {
+		ActiveChild &entry = active_children[i];
+		entry.pending_delta += p_delta;
+		if (_is_child_asleep(entry)) {
+			continue;
+		}
+		if (use_threads) {
+			threaded_queue.push_back(i);
+		} else {
+			entry.status = entry.task->execute(entry.pending_delta);
+			_track_child_sleep(entry);
+		}
+	}
+
+	if (use_threads) {
+		if (threaded_queue.size() == 1) {
+			_execute_threaded_child(0);
+		} else if (threaded_queue.size() > 1) {
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_group_task(
+					callable_mp(this, &BTParallel::_execute_threaded_child), threaded_queue.size(), -1, true, "BTParallel");
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		}
+		for (uint32_t i = 0; i < threaded_queue.size(); i++) {
+			_track_child_sleep(active_children[threaded_queue[i]]);
+		}
+		threaded_queue.clear();
+	}
+
+	int succeeded = num_succeeded;
+	int failed = num_failed;
+	uint32_t num_active = 0;
+	for (uint32_t i = 0; i < active_children.size(); i++) {
+		Status status = active_children[i].status;
+		if (status == SUCCESS || status == FAILURE) {
+			int &counter = status == SUCCESS ? succeeded : failed;
+			counter += 1;
+			if (!repeat) {
+				// * Finished children are removed from the active list until the parallel is re-entered.
+				int &finished = status == SUCCESS ? num_succeeded : num_failed;
+				finished += 1;
+				continue;
+			}
+		}
+		if (num_active != i) {
+			active_children[num_active] = active_children[i];
+		}
+		num_active += 1;
+	}
+	active_children.resize(num_active);
+
+	if (succeeded >= num_successes_required || failed >= num_failures_required) {
+		Status status = _get_status_in_child_order();
+		if (status != RUNNING) {
+			return status;
+		}
+	}
+	if (!repeat && active_children.is_empty()) {
+		return FAILURE;
+	}
+	return RUNNING;
+}
+
+void BTParallel::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	// Children are restored after their parent, so the active list is rebuilt on the next tick.
+	active_dirty = true;
+}
+
+PackedStringArray BTParallel::get_configuration_warnings() {
+	PackedStringArray warnings = BTComposite::get_configuration_warnings();
+	if (run_threaded) {
+		for (int i = 0; i < get_child_count(); i++) {
+			if (!_is_subtree_thread_safe(get_child_ptr(i))) {
+				warnings.append("Threaded execution requires children composed of read-only native tasks, such as BTCheckVar and BTWait. Children will be executed sequentially.");
+				break;
+			}
+		}
 	}
-	return return_status;
+	return warnings;
 }
 
 void BTParallel::_bind_methods() {
@@ -54,8 +267,11 @@ void BTParallel::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_num_failures_required", "value"), &BTParallel::set_num_failures_required);
 	ClassDB::bind_method(D_METHOD("get_repeat"), &BTParallel::get_repeat);
 	ClassDB::bind_method(D_METHOD("set_repeat", "enable"), &BTParallel::set_repeat);
+	ClassDB::bind_method(D_METHOD("get_run_threaded"), &BTParallel::get_run_threaded);
+	ClassDB::bind_method(D_METHOD("set_run_threaded", "enable"), &BTParallel::set_run_threaded);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "num_successes_required"), "set_num_successes_required", "get_num_successes_required");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "num_failures_required"), "set_num_failures_required", "get_num_failures_required");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "repeat"), "set_repeat", "get_repeat");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "run_threaded"), "set_run_threaded", "get_run_threaded");
 }
@@ -19,15 +19,49 @@ class BTParallel : public BTComposite {
 	TASK_CATEGORY(Composites);
 
 private:
+	// Child that can still change its status during the current run.
+	struct ActiveChild {
+		BTTask *task = nullptr;
+		Status status = FRESH; // Written by worker threads in threaded mode.
+		double pending_delta = 0.0; // Delta accumulated while sleeping; passed to the child on wake.
+		double sleep_time = -1.0; // Negative if not sleeping.
+		bool has_wake_var = false;
+		BBVarHandle wake_var;
+		uint32_t wake_var_version = 0;
+		Variant wake_var_value; // Compared instead of the version for bound variables.
+		Ref<Blackboard> wake_blackboard;
+	};
+
 	int num_successes_required = 1;
 	int num_failures_required = 1;
 	bool repeat = false;
+	bool run_threaded = false;
+
+	bool threaded_supported = false; // Children are composed of pure tasks; resolved in _setup().
+	bool blackboard_thread_safe = false;
+	uint32_t blackboard_epoch = 0; // Blackboard layout epoch for which blackboard_thread_safe was resolved.
+	bool active_dirty = true;
+	int num_children = 0;
+	int num_succeeded = 0; // Children that finished in previous ticks when not repeating.
+	int num_failed = 0;
+	LocalVector<ActiveChild> active_children;
+	LocalVector<uint32_t> threaded_queue;
+
+	void _rebuild_active_children();
+	bool _is_child_asleep(ActiveChild &p_child) const;
+	void _track_child_sleep(ActiveChild &p_child);
+	void _execute_threaded_child(uint32_t p_index);
+	Status _get_status_in_child_order() const;
+	bool _is_blackboard_thread_safe();
+	static bool _is_subtree_thread_safe(BTTask *p_task);
 
 protected:
 	static void _bind_methods();
 
+	virtual void _setup() override;
 	virtual void _enter() override;
 	virtual Status _tick(double p_delta) override;
+	virtual void _load_state(const Ref<StreamPeerBuffer> &p_stream) override;
 
 public:
 	int get_num_successes_required() const { return num_successes_required; }
@@ -43,8 +77,16 @@ public:
 	bool get_repeat() const { return repeat; }
 	void set_repeat(bool p_value) {
 		repeat = p_value;
+		active_dirty = true;
 		emit_changed();
 	}
+	bool get_run_threaded() const { return run_threaded; }
+	void set_run_threaded(bool p_value) {
+		run_threaded = p_value;
+		emit_changed();
+	}
+
+	virtual PackedStringArray get_configuration_warnings() override;
 };
 
 #endif // BT_PARALLEL_H
@@ -88,6 +88,27 @@ BT::Status BTProbabilitySelector::_tick(double p_delta) {
 	return FAILURE;
 }
 
+void BTProbabilitySelector::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	// Tasks are stored by child index.
+	p_stream->put_32(selected_task.is_valid() ? selected_task->get_index() : -1);
+	p_stream->put_32(failed_tasks.size());
+	for (const Ref<BTTask> &task : failed_tasks) {
+		p_stream->put_32(task->get_index());
+	}
+}
+
+void BTProbabilitySelector::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	int selected_idx = p_stream->get_32();
+	selected_task = selected_idx >= 0 && selected_idx < get_child_count() ? get_child(selected_idx) : Ref<BTTask>();
+	failed_tasks.clear();
+	int num_failed = p_stream->get_32();
+	for (int i = 0; i < num_failed; i++) {
+		int idx = p_stream->get_32();
+		ERR_CONTINUE(idx < 0 || idx >= get_child_count());
+		failed_tasks.insert(get_child(idx));
+	}
+}
+
 void BTProbabilitySelector::_select_task() {
 	selected_task.unref();
 
@@ -25,7 +25,7 @@ void BTRandomSequence::_enter() {
 BT::Status BTRandomSequence::_tick(double p_delta) {
 	Status status = SUCCESS;
 	for (int i = last_running_idx; i < get_child_count(); i++) {
-		status = get_child(indicies[i])->execute(p_delta);
+		status = get_child_ptr(indicies[i])->execute(p_delta);
 		if (status != SUCCESS) {
 			last_running_idx = i;
 			break;
@@ -33,3 +33,26 @@ BT::Status BTRandomSequence::_tick(double p_delta) {
 	}
 	return status;
 }
+
+void BTRandomSequence::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_32(last_running_idx);
+	p_stream->put_var(indicies);
+}
+
+void BTRandomSequence::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	last_running_idx = CLAMP(p_stream->get_32(), 0, get_child_count());
+	Variant saved_indicies = p_stream->get_var();
+	indicies = saved_indicies.get_type() == Variant::ARRAY ? Array(saved_indicies) : Array();
+	bool valid = indicies.size() == get_child_count();
+	for (int i = 0; valid && i < indicies.size(); i++) {
+		valid = indicies[i].get_type() == Variant::INT && int(indicies[i]) >= 0 && int(indicies[i]) < get_child_count();
+	}
+	if (!valid) {
+		// * Order doesn't match the children; start over from the first child.
+		indicies.resize(get_child_count());
+		for (int i = 0; i < get_child_count(); i++) {
+			indicies[i] = i;
+		}
+		last_running_idx = 0;
+	}
+}
@@ -26,6 +26,9 @@ protected:
 
 	virtual void _enter() override;
 	virtual Status _tick(double p_delta) override;
+	virtual void _save_state(const Ref<StreamPeerBuffer> &p_stream) const override;
+	virtual void _load_state(const Ref<StreamPeerBuffer> &p_stream) override;
+	virtual bool _propagates_sleep() const override { return true; }
 };
 
 #endif // BT_SELECTOR_H
@@ -18,7 +18,7 @@ void BTSequence::_enter() {
 BT::Status BTSequence::_tick(double p_delta) {
 	Status status = SUCCESS;
 	for (int i = last_running_idx; i < get_child_count(); i++) {
-		status = get_child(i)->execute(p_delta);
+		status = get_child_ptr(i)->execute(p_delta);
 		if (status != SUCCESS) {
 			last_running_idx = i;
 			break;
@@ -26,3 +26,11 @@ BT::Status BTSequence::_tick(double p_delta) {
 	}
 	return status;
 }
+
+void BTSequence::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_32(last_running_idx);
+}
+
+void BTSequence::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	last_running_idx = CLAMP(p_stream->get_32(), 0, get_child_count());
+}
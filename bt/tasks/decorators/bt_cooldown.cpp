@@ -11,8 +11,8 @@
 
 #include "bt_cooldown.h"
 
-#include "../../../compat/scene_tree.h"
 #include "../../../util/limbo_string_names.h"
+#include "../../bt_scheduler.h"
 
 //**** Setters / Getters
 
@@ -48,10 +48,14 @@ String BTCooldown::_generate_name() {
 }
 
 void BTCooldown::_setup() {
+	// * Recycled instances are set up again; timeouts from the previous run are ignored in _timeout_callback().
+	cooling = false;
+	expiry_time = 0.0;
 	if (cooldown_state_var == StringName()) {
 		cooldown_state_var = vformat("cooldown_%d", get_instance_id());
 	}
 	get_blackboard()->set_var(cooldown_state_var, false);
+	state_var_handle = get_blackboard()->resolve_var(cooldown_state_var);
 	if (start_cooled) {
 		_chill();
 	}
@@ -59,10 +63,10 @@ void BTCooldown::_setup() {
 
 BT::Status BTCooldown::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(get_child_count() == 0, FAILURE, "BT decorator has no child.");
-	if (get_blackboard()->get_var(cooldown_state_var, true)) {
+	if (get_blackboard()->get_var_by_handle(state_var_handle, true)) {
 		return FAILURE;
 	}
-	Status status = get_child(0)->execute(p_delta);
+	Status status = get_child_ptr(0)->execute(p_delta);
 	if (status == SUCCESS || (trigger_on_failure && status == FAILURE)) {
 		_chill();
 	}
@@ -70,19 +74,45 @@ BT::Status BTCooldown::_tick(double p_delta) {
 }
 
 void BTCooldown::_chill() {
-	get_blackboard()->set_var(cooldown_state_var, true);
-	if (timer.is_valid()) {
-		timer->set_time_left(duration);
+	get_blackboard()->set_var_by_handle(state_var_handle, true);
+	_start_timer(duration);
+}
+
+void BTCooldown::_start_timer(double p_time_left) {
+	ERR_FAIL_NULL(BTScheduler::get_singleton());
+	// Earlier timeouts are ignored in _timeout_callback().
+	expiry_time = BTScheduler::get_singleton()->add_timeout(this, p_time_left, process_pause, &BTCooldown::_timeout_callback);
+	cooling = true;
+}
+
+void BTCooldown::_timeout_callback(Object *p_object) {
+	BTCooldown *cooldown = Object::cast_to<BTCooldown>(p_object);
+	if (cooldown && cooldown->cooling && BTScheduler::get_singleton()->get_clock(cooldown->process_pause) >= cooldown->expiry_time) {
+		cooldown->_on_timeout();
+	}
+}
+
+void BTCooldown::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	double time_left = 0.0;
+	if (cooling && BTScheduler::get_singleton()) {
+		time_left = MAX(0.0, expiry_time - BTScheduler::get_singleton()->get_clock(process_pause));
+	}
+	p_stream->put_double(time_left);
+}
+
+void BTCooldown::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	// The cooldown state variable itself is restored with the blackboard.
+	double time_left = p_stream->get_double();
+	if (time_left > 0.0) {
+		_start_timer(time_left);
 	} else {
-		timer = SCENE_TREE()->create_timer(duration, process_pause);
-		ERR_FAIL_COND(timer.is_null());
-		timer->connect(LW_NAME(timeout), callable_mp(this, &BTCooldown::_on_timeout), CONNECT_ONE_SHOT);
+		cooling = false;
 	}
 }
 
 void BTCooldown::_on_timeout() {
-	get_blackboard()->set_var(cooldown_state_var, false);
-	timer.unref();
+	cooling = false;
+	get_blackboard()->set_var_by_handle(state_var_handle, false);
 }
 
 //**** Godot
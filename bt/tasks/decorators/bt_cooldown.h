@@ -14,14 +14,6 @@
 
 #include "../bt_decorator.h"
 
-#ifdef LIMBOAI_MODULE
-#include "scene/main/scene_tree.h"
-#endif
-
-#ifdef LIMBOAI_GDEXTENSION
-#include <godot_cpp/classes/scene_tree_timer.hpp>
-#endif
-
 class BTCooldown : public BTDecorator {
 	GDCLASS(BTCooldown, BTDecorator);
 	TASK_CATEGORY(Decorators);
@@ -33,10 +25,14 @@ private:
 	bool trigger_on_failure = false;
 	StringName cooldown_state_var = "";
 
-	Ref<SceneTreeTimer> timer = nullptr;
+	BBVarHandle state_var_handle;
+	bool cooling = false;
+	double expiry_time = 0.0; // On the BTScheduler clock.
 
 	void _chill();
+	void _start_timer(double p_time_left);
 	void _on_timeout();
+	static void _timeout_callback(Object *p_object);
 
 protected:
 	static void _bind_methods();
@@ -44,6 +40,9 @@ protected:
 	virtual String _generate_name() override;
 	virtual void _setup() override;
 	virtual Status _tick(double p_delta) override;
+	virtual void _save_state(const Ref<StreamPeerBuffer> &p_stream) const override;
+	virtual void _load_state(const Ref<StreamPeerBuffer> &p_stream) override;
+	virtual bool _propagates_sleep() const override { return true; }
 
 public:
 	void set_duration(double p_value);
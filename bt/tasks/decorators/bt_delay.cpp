@@ -23,9 +23,10 @@ String BTDelay::_generate_name() {
 BT::Status BTDelay::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(get_child_count() == 0, FAILURE, "BT decorator has no child.");
 	if (get_elapsed_time() <= seconds) {
+		request_sleep(seconds - get_elapsed_time());
 		return RUNNING;
 	}
-	return get_child(0)->execute(p_delta);
+	return get_child_ptr(0)->execute(p_delta);
 }
 
 void BTDelay::_bind_methods() {
@@ -18,14 +18,177 @@
 
 void BTForEach::set_array_var(const StringName &p_value) {
 	array_var = p_value;
+	array_var_handle.reset(array_var);
+	_clear_source();
 	emit_changed();
 }
 
 void BTForEach::set_save_var(const StringName &p_value) {
 	save_var = p_value;
+	save_var_handle.reset(save_var);
 	emit_changed();
 }
 
+void BTForEach::set_iteration_mode(IterationMode p_mode) {
+	iteration_mode = p_mode;
+	_clear_source();
+	emit_changed();
+}
+
+//**** Source
+
+void BTForEach::_clear_source() {
+	source_kind = SOURCE_NONE;
+	source_array = Array();
+	source_int32 = PackedInt32Array();
+	source_int64 = PackedInt64Array();
+	source_float32 = PackedFloat32Array();
+	source_float64 = PackedFloat64Array();
+	source_vector2 = PackedVector2Array();
+	source_vector3 = PackedVector3Array();
+	range_size = 0;
+}
+
+bool BTForEach::_fetch_source() {
+	_clear_source();
+
+	Variant source = get_blackboard()->get_var_by_handle(array_var_handle, Variant());
+	source_version = get_blackboard()->get_var_version_by_handle(array_var_handle);
+	source_storage = array_var_handle.found ? array_var_handle.var.get_storage_id() : 0;
+
+	// * Packed arrays are copy-on-write, so holding a reference is a snapshot in itself.
+	switch (source.get_type()) {
+		case Variant::PACKED_INT32_ARRAY: {
+			source_int32 = source;
+			source_kind = SOURCE_INT32;
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			source_int64 = source;
+			source_kind = SOURCE_INT64;
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			source_float32 = source;
+			source_kind = SOURCE_FLOAT32;
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			source_float64 = source;
+			source_kind = SOURCE_FLOAT64;
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			source_vector2 = source;
+			source_kind = SOURCE_VECTOR2;
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			source_vector3 = source;
+			source_kind = SOURCE_VECTOR3;
+		} break;
+		case Variant::INT: {
+			// * Range [0, n).
+			int64_t end = source;
+			range_begin = 0;
+			range_step = 1;
+			range_size = CLAMP(end, 0, INT32_MAX);
+			source_kind = SOURCE_RANGE;
+		} break;
+		case Variant::VECTOR2I:
+		case Variant::VECTOR3I: {
+			// * Range [x, y) with an optional step in z.
+			Vector3i range;
+			if (source.get_type() == Variant::VECTOR2I) {
+				Vector2i bounds = source;
+				range = Vector3i(bounds.x, bounds.y, 1);
+			} else {
+				range = source;
+			}
+			ERR_FAIL_COND_V_MSG(range.z == 0, false, "BTForEach: Range step can't be zero.");
+			range_begin = range.x;
+			range_step = range.z;
+			int64_t span = range.z > 0 ? int64_t(range.y) - int64_t(range.x) : int64_t(range.x) - int64_t(range.y);
+			int64_t step = ABS(range_step);
+			range_size = span > 0 ? MIN((span + step - 1) / step, int64_t(INT32_MAX)) : 0;
+			source_kind = SOURCE_RANGE;
+		} break;
+		case Variant::ARRAY: {
+			source_array = source;
+			if (iteration_mode == ITERATION_SNAPSHOT) {
+				source_array = source_array.duplicate();
+			}
+			source_kind = SOURCE_ARRAY;
+		} break;
+		default: {
+			// * Other packed arrays are converted once per fetch.
+			source_array = source;
+			source_kind = SOURCE_ARRAY;
+		} break;
+	}
+	return true;
+}
+
+bool BTForEach::_is_source_stale() {
+	uint32_t version = get_blackboard()->get_var_version_by_handle(array_var_handle);
+	if (!array_var_handle.found) {
+		return source_storage != 0;
+	}
+	// * Bound variables don't track changes to their property.
+	return array_var_handle.var.is_bound() || version != source_version || array_var_handle.var.get_storage_id() != source_storage;
+}
+
+int BTForEach::_get_source_size() const {
+	switch (source_kind) {
+		case SOURCE_ARRAY:
+			return source_array.size();
+		case SOURCE_INT32:
+			return source_int32.size();
+		case SOURCE_INT64:
+			return source_int64.size();
+		case SOURCE_FLOAT32:
+			return source_float32.size();
+		case SOURCE_FLOAT64:
+			return source_float64.size();
+		case SOURCE_VECTOR2:
+			return source_vector2.size();
+		case SOURCE_VECTOR3:
+			return source_vector3.size();
+		case SOURCE_RANGE:
+			return range_size;
+		case SOURCE_NONE:
+			break;
+	}
+	return 0;
+}
+
+void BTForEach::_store_element(int p_idx) {
+	Blackboard *bb = get_blackboard().ptr();
+	switch (source_kind) {
+		case SOURCE_ARRAY: {
+			bb->set_var_by_handle(save_var_handle, source_array[p_idx]);
+		} break;
+		case SOURCE_INT32: {
+			bb->set_typed_by_handle<int64_t>(save_var_handle, source_int32[p_idx]);
+		} break;
+		case SOURCE_INT64: {
+			bb->set_typed_by_handle<int64_t>(save_var_handle, source_int64[p_idx]);
+		} break;
+		case SOURCE_FLOAT32: {
+			bb->set_typed_by_handle<double>(save_var_handle, source_float32[p_idx]);
+		} break;
+		case SOURCE_FLOAT64: {
+			bb->set_typed_by_handle<double>(save_var_handle, source_float64[p_idx]);
+		} break;
+		case SOURCE_VECTOR2: {
+			bb->set_typed_by_handle<Vector2>(save_var_handle, source_vector2[p_idx]);
+		} break;
+		case SOURCE_VECTOR3: {
+			bb->set_typed_by_handle<Vector3>(save_var_handle, source_vector3[p_idx]);
+		} break;
+		case SOURCE_RANGE: {
+			bb->set_typed_by_handle<int64_t>(save_var_handle, range_begin + range_step * p_idx);
+		} break;
+		case SOURCE_NONE:
+			break;
+	}
+}
+
 //**** Task Implementation
 
 String BTForEach::_generate_name() {
@@ -34,8 +197,19 @@ String BTForEach::_generate_name() {
 			LimboUtility::get_singleton()->decorate_var(array_var));
 }
 
+void BTForEach::_setup() {
+	array_var_handle = get_blackboard()->resolve_var(array_var);
+	save_var_handle = get_blackboard()->resolve_var(save_var);
+}
+
 void BTForEach::_enter() {
 	current_idx = 0;
+	_clear_source();
+}
+
+void BTForEach::_exit() {
+	// * Release the source, so that large arrays aren't kept alive between runs.
+	_clear_source();
 }
 
 BT::Status BTForEach::_tick(double p_delta) {
@@ -43,22 +217,27 @@ BT::Status BTForEach::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(save_var == StringName(), FAILURE, "BTForEach: Save variable is not set.");
 	ERR_FAIL_COND_V_MSG(array_var == StringName(), FAILURE, "BTForEach: Array variable is not set.");
 
-	Array arr = get_blackboard()->get_var(array_var, Variant());
-	if (current_idx >= arr.size()) {
+	if (source_kind == SOURCE_NONE || (iteration_mode == ITERATION_LIVE && _is_source_stale())) {
+		if (!_fetch_source()) {
+			return FAILURE;
+		}
+	}
+
+	int size = _get_source_size();
+	if (current_idx >= size) {
 		if (current_idx != 0) {
 			WARN_PRINT("BTForEach: Array size changed during iteration.");
 		}
 		return SUCCESS;
 	}
-	Variant elem = arr[current_idx];
-	get_blackboard()->set_var(save_var, elem);
+	_store_element(current_idx);
 
-	Status status = get_child(0)->execute(p_delta);
+	Status status = get_child_ptr(0)->execute(p_delta);
 	if (status == RUNNING) {
 		return RUNNING;
 	} else if (status == FAILURE) {
 		return FAILURE;
-	} else if (current_idx == (arr.size() - 1)) {
+	} else if (current_idx == (size - 1)) {
 		return SUCCESS;
 	} else {
 		current_idx += 1;
@@ -66,6 +245,16 @@ BT::Status BTForEach::_tick(double p_delta) {
 	}
 }
 
+void BTForEach::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_32(current_idx);
+}
+
+void BTForEach::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	current_idx = MAX(0, p_stream->get_32());
+	// * Source is fetched again on the next tick.
+	_clear_source();
+}
+
 //**** Godot
 
 void BTForEach::_bind_methods() {
@@ -73,7 +262,13 @@ void BTForEach::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_array_var"), &BTForEach::get_array_var);
 	ClassDB::bind_method(D_METHOD("set_save_var", "variable"), &BTForEach::set_save_var);
 	ClassDB::bind_method(D_METHOD("get_save_var"), &BTForEach::get_save_var);
+	ClassDB::bind_method(D_METHOD("set_iteration_mode", "mode"), &BTForEach::set_iteration_mode);
+	ClassDB::bind_method(D_METHOD("get_iteration_mode"), &BTForEach::get_iteration_mode);
 
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "array_var"), "set_array_var", "get_array_var");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "save_var"), "set_save_var", "get_save_var");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "iteration_mode", PROPERTY_HINT_ENUM, "Live,Snapshot"), "set_iteration_mode", "get_iteration_mode");
+
+	BIND_ENUM_CONSTANT(ITERATION_LIVE);
+	BIND_ENUM_CONSTANT(ITERATION_SNAPSHOT);
 }
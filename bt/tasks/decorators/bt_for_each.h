@@ -18,18 +18,66 @@ class BTForEach : public BTDecorator {
 	GDCLASS(BTForEach, BTDecorator);
 	TASK_CATEGORY(Decorators);
 
+public:
+	enum IterationMode {
+		ITERATION_LIVE,
+		ITERATION_SNAPSHOT,
+	};
+
 private:
+	// Source of the iteration, cached in a typed form to avoid boxing elements into Variants.
+	enum SourceKind {
+		SOURCE_NONE,
+		SOURCE_ARRAY,
+		SOURCE_INT32,
+		SOURCE_INT64,
+		SOURCE_FLOAT32,
+		SOURCE_FLOAT64,
+		SOURCE_VECTOR2,
+		SOURCE_VECTOR3,
+		SOURCE_RANGE,
+	};
+
 	StringName array_var;
 	StringName save_var;
+	IterationMode iteration_mode = ITERATION_LIVE;
 
 	int current_idx;
 
+	BBVarHandle array_var_handle;
+	BBVarHandle save_var_handle;
+
+	SourceKind source_kind = SOURCE_NONE;
+	uint64_t source_storage = 0;
+	uint32_t source_version = 0;
+	Array source_array;
+	PackedInt32Array source_int32;
+	PackedInt64Array source_int64;
+	PackedFloat32Array source_float32;
+	PackedFloat64Array source_float64;
+	PackedVector2Array source_vector2;
+	PackedVector3Array source_vector3;
+	int64_t range_begin = 0;
+	int64_t range_step = 1;
+	int range_size = 0;
+
+	bool _fetch_source();
+	void _clear_source();
+	bool _is_source_stale();
+	int _get_source_size() const;
+	void _store_element(int p_idx);
+
 protected:
 	static void _bind_methods();
 
 	virtual String _generate_name() override;
+	virtual void _setup() override;
 	virtual void _enter() override;
+	virtual void _exit() override;
 	virtual Status _tick(double p_delta) override;
+	virtual void _save_state(const Ref<StreamPeerBuffer> &p_stream) const override;
+	virtual void _load_state(const Ref<StreamPeerBuffer> &p_stream) override;
+	virtual bool _propagates_sleep() const override { return true; }
 
 public:
 	void set_array_var(const StringName &p_value);
@@ -37,6 +85,11 @@ public:
 
 	void set_save_var(const StringName &p_value);
 	StringName get_save_var() const { return save_var; }
+
+	void set_iteration_mode(IterationMode p_mode);
+	IterationMode get_iteration_mode() const { return iteration_mode; }
 };
 
+VARIANT_ENUM_CAST(BTForEach::IterationMode);
+
 #endif // BT_FOR_EACH_H
@@ -36,6 +36,7 @@ protected:
 	Ref<BlackboardPlan> get_blackboard_plan() const { return blackboard_plan; }
 
 	virtual Status _tick(double p_delta) override;
+	virtual bool _propagates_sleep() const override { return true; }
 
 public:
 	virtual void initialize(Node *p_agent, const Ref<Blackboard> &p_blackboard, Node *p_scene_root) override;
@@ -26,7 +26,7 @@ void BTRepeat::_enter() {
 
 BT::Status BTRepeat::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(get_child_count() == 0, FAILURE, "BT decorator has no child.");
-	Status status = get_child(0)->execute(p_delta);
+	Status status = get_child_ptr(0)->execute(p_delta);
 	if (status == RUNNING || forever) {
 		return RUNNING;
 	} else if (status == FAILURE && abort_on_failure) {
@@ -39,6 +39,14 @@ BT::Status BTRepeat::_tick(double p_delta) {
 	}
 }
 
+void BTRepeat::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_32(cur_iteration);
+}
+
+void BTRepeat::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	cur_iteration = p_stream->get_32();
+}
+
 void BTRepeat::set_forever(bool p_forever) {
 	forever = p_forever;
 	notify_property_list_changed();
@@ -13,7 +13,7 @@
 
 BT::Status BTRepeatUntilSuccess::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(get_child_count() == 0, FAILURE, "BT decorator has no child.");
-	if (get_child(0)->execute(p_delta) == SUCCESS) {
+	if (get_child_ptr(0)->execute(p_delta) == SUCCESS) {
 		return SUCCESS;
 	}
 	return RUNNING;
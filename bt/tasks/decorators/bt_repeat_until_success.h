@@ -22,6 +22,7 @@ protected:
 	static void _bind_methods() {}
 
 	virtual Status _tick(double p_delta) override;
+	virtual bool _propagates_sleep() const override { return true; }
 };
 
 #endif // BT_REPEAT_UNTIL_SUCCESS_H
@@ -25,12 +25,17 @@ String BTRunLimit::_generate_name() {
 	return vformat("RunLimit x%d", run_limit);
 }
 
+void BTRunLimit::_setup() {
+	// Reset the counter if the instance is recycled (see BTInstance::reset()).
+	num_runs = 0;
+}
+
 BT::Status BTRunLimit::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(get_child_count() == 0, FAILURE, "BT decorator has no child.");
 	if (num_runs >= run_limit) {
 		return FAILURE;
 	}
-	Status child_status = get_child(0)->execute(p_delta);
+	Status child_status = get_child_ptr(0)->execute(p_delta);
 	if ((count_policy == COUNT_SUCCESSFUL && child_status == SUCCESS) ||
 			(count_policy == COUNT_FAILED && child_status == FAILURE) ||
 			(count_policy == COUNT_ALL && child_status != RUNNING)) {
@@ -39,6 +44,14 @@ BT::Status BTRunLimit::_tick(double p_delta) {
 	return child_status;
 }
 
+void BTRunLimit::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_32(num_runs);
+}
+
+void BTRunLimit::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	num_runs = p_stream->get_32();
+}
+
 void BTRunLimit::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_run_limit", "max_runs"), &BTRunLimit::set_run_limit);
 	ClassDB::bind_method(D_METHOD("get_run_limit"), &BTRunLimit::get_run_limit);
@@ -22,6 +22,7 @@ class BTSubtree : public BTNewScope {
 
 private:
 	Ref<BehaviorTree> subtree;
+	bool subtree_instantiated = false;
 
 protected:
 	static void _bind_methods();
@@ -30,6 +31,7 @@ protected:
 
 	virtual String _generate_name() override;
 	virtual Status _tick(double p_delta) override;
+	virtual bool _propagates_sleep() const override { return true; }
 
 public:
 	void set_subtree(const Ref<BehaviorTree> &p_value);
@@ -61,6 +61,12 @@ String BTCheckAgentProperty::_generate_name() {
 			value.is_valid() ? Variant(value) : Variant("???"));
 }
 
+void BTCheckAgentProperty::_setup() {
+	if (value.is_valid()) {
+		value_handle = value->resolve(get_blackboard());
+	}
+}
+
 BT::Status BTCheckAgentProperty::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(property == StringName(), FAILURE, "BTCheckAgentProperty: `property` is not set.");
 	ERR_FAIL_COND_V_MSG(!value.is_valid(), FAILURE, "BTCheckAgentProperty: `value` is not set.");
@@ -73,7 +79,7 @@ BT::Status BTCheckAgentProperty::_tick(double p_delta) {
 	Variant left_value = get_agent()->get(property);
 #endif
 
-	Variant right_value = value->get_value(get_scene_root(), get_blackboard());
+	Variant right_value = value->get_value_by_handle(get_scene_root(), get_blackboard(), value_handle);
 
 	return LimboUtility::get_singleton()->perform_check(check_type, left_value, right_value) ? SUCCESS : FAILURE;
 }
@@ -117,6 +117,20 @@ BT::Status BTPlayAnimation::_tick(double p_delta) {
 	return SUCCESS;
 }
 
+void BTPlayAnimation::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	// Playback position of the animation started in _enter(); negative if it's not playing.
+	bool playing = !setup_failed && animation_player->is_playing() && animation_player->get_assigned_animation() == animation_name;
+	p_stream->put_double(playing ? animation_player->get_current_animation_position() : -1.0);
+}
+
+void BTPlayAnimation::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	double position = p_stream->get_double();
+	if (!setup_failed && get_status() == RUNNING && position >= 0.0) {
+		animation_player->play(animation_name, blend, speed, from_end);
+		animation_player->seek(position, true);
+	}
+}
+
 //**** Godot
 
 void BTPlayAnimation::_bind_methods() {
@@ -46,6 +46,8 @@ protected:
 	virtual void _setup() override;
 	virtual void _enter() override;
 	virtual Status _tick(double p_delta) override;
+	virtual void _save_state(const Ref<StreamPeerBuffer> &p_stream) const override;
+	virtual void _load_state(const Ref<StreamPeerBuffer> &p_stream) override;
 
 public:
 	void set_animation_player(Ref<BBNode> p_animation_player);
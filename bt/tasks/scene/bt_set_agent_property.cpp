@@ -62,13 +62,19 @@ String BTSetAgentProperty::_generate_name() {
 			value.is_valid() ? Variant(value) : Variant("???"));
 }
 
+void BTSetAgentProperty::_setup() {
+	if (value.is_valid()) {
+		value_handle = value->resolve(get_blackboard());
+	}
+}
+
 BT::Status BTSetAgentProperty::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(property == StringName(), FAILURE, "BTSetAgentProperty: `property` is not set.");
 	ERR_FAIL_COND_V_MSG(!value.is_valid(), FAILURE, "BTSetAgentProperty: `value` is not set.");
 
 	Variant result;
 	StringName error_value = LW_NAME(error_value);
-	Variant right_value = value->get_value(get_scene_root(), get_blackboard(), error_value);
+	Variant right_value = value->get_value_by_handle(get_scene_root(), get_blackboard(), value_handle, error_value);
 	ERR_FAIL_COND_V_MSG(right_value == Variant(error_value), FAILURE, "BTSetAgentProperty: Couldn't get value of value-parameter.");
 	bool r_valid;
 	if (operation == LimboUtility::OPERATION_NONE) {
@@ -24,12 +24,14 @@ class BTSetAgentProperty : public BTAction {
 private:
 	StringName property;
 	Ref<BBVariant> value;
+	BBParamHandle value_handle;
 	LimboUtility::Operation operation = LimboUtility::OPERATION_NONE;
 
 protected:
 	static void _bind_methods();
 
 	virtual String _generate_name() override;
+	virtual void _setup() override;
 	virtual Status _tick(double p_delta) override;
 
 public:
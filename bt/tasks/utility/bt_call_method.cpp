@@ -27,6 +27,10 @@
 
 void BTCallMethod::set_method(const StringName &p_method_name) {
 	method = p_method_name;
+#ifdef LIMBOAI_MODULE
+	cached_class = StringName();
+	cached_method_bind = nullptr;
+#endif
 	emit_changed();
 }
 
@@ -86,46 +90,81 @@ String BTCallMethod::_generate_name() {
 			result_var == StringName() ? "" : LimboUtility::get_singleton()->decorate_output_var(result_var));
 }
 
+void BTCallMethod::_setup() {
+	if (node_param.is_valid()) {
+		node_handle = node_param->resolve(get_blackboard());
+	}
+	arg_handles.resize(args.size());
+	for (int i = 0; i < args.size(); i++) {
+		Ref<BBVariant> param = args[i];
+		if (param.is_valid()) {
+			arg_handles[i] = param->resolve(get_blackboard());
+		}
+	}
+	_prepare_call_args();
+}
+
+void BTCallMethod::_prepare_call_args() {
+	const int argument_count = args.size() + int(include_delta);
+	call_args.resize(argument_count);
+#ifdef LIMBOAI_MODULE
+	call_argptrs.resize(argument_count);
+	for (int i = 0; i < argument_count; i++) {
+		call_argptrs[i] = &call_args[i];
+	}
+#endif
+}
+
+#ifdef LIMBOAI_MODULE
+MethodBind *BTCallMethod::_get_method_bind(Object *p_object) {
+	if (p_object->get_script_instance()) {
+		// * Scripts may define or override the method, so they go through callp().
+		return nullptr;
+	}
+	const StringName &class_name = p_object->get_class_name();
+	if (unlikely(class_name != cached_class)) {
+		cached_class = class_name;
+		cached_method_bind = ClassDB::get_method(class_name, method);
+	}
+	return cached_method_bind;
+}
+#endif // LIMBOAI_MODULE
+
 BT::Status BTCallMethod::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(method == StringName(), FAILURE, "BTCallMethod: Method Name is not set.");
 	ERR_FAIL_COND_V_MSG(node_param.is_null(), FAILURE, "BTCallMethod: Node parameter is not set.");
-	Object *obj = node_param->get_value(get_scene_root(), get_blackboard());
+	Object *obj = node_param->get_value_by_handle(get_scene_root(), get_blackboard(), node_handle);
 	ERR_FAIL_COND_V_MSG(obj == nullptr, FAILURE, "BTCallMethod: Failed to get object: " + node_param->to_string());
+	const int argument_count = args.size() + int(include_delta);
+	if (unlikely(arg_handles.size() != (uint32_t)args.size() || (int)call_args.size() != argument_count)) {
+		// Arguments were changed after setup; new handles are resolved on first use.
+		arg_handles.resize(args.size());
+		_prepare_call_args();
+	}
+
+	if (include_delta) {
+		call_args[0] = p_delta;
+	}
+	for (int i = 0; i < args.size(); i++) {
+		Ref<BBVariant> param = args[i];
+		call_args[i + int(include_delta)] = param->get_value_by_handle(get_scene_root(), get_blackboard(), arg_handles[i]);
+	}
 
 	Variant result;
-	Array call_args;
 
 #ifdef LIMBOAI_MODULE
-	const Variant delta = include_delta ? Variant(p_delta) : Variant();
-	const Variant **argptrs = nullptr;
-
-	int argument_count = include_delta ? args.size() + 1 : args.size();
-	if (argument_count > 0) {
-		argptrs = (const Variant **)alloca(sizeof(Variant *) * argument_count);
-		if (include_delta) {
-			argptrs[0] = &delta;
-		}
-		for (int i = 0; i < args.size(); i++) {
-			Ref<BBVariant> param = args[i];
-			call_args.push_back(param->get_value(get_scene_root(), get_blackboard()));
-			argptrs[i + int(include_delta)] = &call_args[i];
-		}
-	}
-
+	const Variant **argptrs = argument_count > 0 ? call_argptrs.ptr() : nullptr;
 	Callable::CallError ce;
-	result = obj->callp(method, argptrs, argument_count, ce);
+	MethodBind *method_bind = _get_method_bind(obj);
+	if (method_bind) {
+		result = method_bind->call(obj, argptrs, argument_count, ce);
+	} else {
+		result = obj->callp(method, argptrs, argument_count, ce);
+	}
 	if (ce.error != Callable::CallError::CALL_OK) {
 		ERR_FAIL_V_MSG(FAILURE, "BTCallMethod: Error calling method: " + Variant::get_call_error_text(obj, method, argptrs, argument_count, ce) + ".");
 	}
 #elif LIMBOAI_GDEXTENSION
-	if (include_delta) {
-		call_args.push_back(Variant(p_delta));
-	}
-	for (int i = 0; i < args.size(); i++) {
-		Ref<BBVariant> param = args[i];
-		call_args.push_back(param->get_value(get_scene_root(), get_blackboard()));
-	}
-
 	// TODO: Unsure how to detect call error, so we return SUCCESS for now...
 	result = obj->callv(method, call_args);
 #endif // LIMBOAI_MODULE & LIMBOAI_GDEXTENSION
@@ -25,13 +25,30 @@ private:
 	StringName method;
 	Ref<BBNode> node_param;
 	TypedArray<BBVariant> args;
+	BBParamHandle node_handle;
+	LocalVector<BBParamHandle> arg_handles;
 	bool include_delta = false;
 	StringName result_var;
 
+#ifdef LIMBOAI_MODULE
+	// * Method bind resolved for the class of the last called object.
+	StringName cached_class;
+	MethodBind *cached_method_bind = nullptr;
+	LocalVector<Variant> call_args;
+	LocalVector<const Variant *> call_argptrs;
+
+	MethodBind *_get_method_bind(Object *p_object);
+#elif LIMBOAI_GDEXTENSION
+	Array call_args;
+#endif // LIMBOAI_MODULE & LIMBOAI_GDEXTENSION
+
+	void _prepare_call_args();
+
 protected:
 	static void _bind_methods();
 
 	virtual String _generate_name() override;
+	virtual void _setup() override;
 	virtual Status _tick(double p_delta) override;
 
 public:
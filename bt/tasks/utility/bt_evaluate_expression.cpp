@@ -17,12 +17,41 @@
 
 #ifdef LIMBOAI_MODULE
 #include "core/config/engine.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 #endif // LIMBOAI_MODULE
 
 #ifdef LIMBOAI_GDEXTENSION
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/mutex.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
 #endif // LIMBOAI_GDEXTENSION
 
+namespace {
+
+// Parsed expressions are shared between tasks with the same expression string and input names.
+// A cached Expression is never parsed again, so it's only used for execution.
+// Entries are released when the last task using them is parsed again or destroyed.
+struct CachedExpression {
+	Ref<Expression> expression;
+	Error error = FAILED;
+	uint32_t users = 0;
+};
+
+HashMap<String, CachedExpression> expression_cache;
+
+#ifdef LIMBOAI_MODULE
+Mutex expression_cache_mutex;
+_FORCE_INLINE_ void _lock_expression_cache() { expression_cache_mutex.lock(); }
+_FORCE_INLINE_ void _unlock_expression_cache() { expression_cache_mutex.unlock(); }
+#elif LIMBOAI_GDEXTENSION
+Ref<Mutex> expression_cache_mutex;
+_FORCE_INLINE_ void _lock_expression_cache() { expression_cache_mutex->lock(); }
+_FORCE_INLINE_ void _unlock_expression_cache() { expression_cache_mutex->unlock(); }
+#endif // LIMBOAI_MODULE & LIMBOAI_GDEXTENSION
+
+} //namespace
+
 //**** Setters / Getters
 
 void BTEvaluateExpression::set_expression_string(const String &p_expression_string) {
@@ -44,6 +73,7 @@ void BTEvaluateExpression::set_input_include_delta(bool p_input_include_delta) {
 		processed_input_values.resize(input_values.size() + int(p_input_include_delta));
 	}
 	input_include_delta = p_input_include_delta;
+	inputs_dirty = true;
 	emit_changed();
 }
 
@@ -53,10 +83,18 @@ void BTEvaluateExpression::set_input_names(const PackedStringArray &p_input_name
 }
 
 void BTEvaluateExpression::set_input_values(const TypedArray<BBVariant> &p_input_values) {
+	const Callable mark_dirty = callable_mp(this, &BTEvaluateExpression::_mark_inputs_dirty);
+	for (int i = 0; i < input_values.size(); i++) {
+		Ref<BBVariant> bb_variant = input_values[i];
+		if (bb_variant.is_valid() && bb_variant->is_connected(LW_NAME(changed), mark_dirty)) {
+			bb_variant->disconnect(LW_NAME(changed), mark_dirty);
+		}
+	}
 	if (input_values.size() != p_input_values.size()) {
 		processed_input_values.resize(p_input_values.size() + int(input_include_delta));
 	}
 	input_values = p_input_values;
+	inputs_dirty = true;
 	emit_changed();
 }
 
@@ -83,10 +121,38 @@ PackedStringArray BTEvaluateExpression::get_configuration_warnings() {
 }
 
 void BTEvaluateExpression::_setup() {
+	if (node_param.is_valid()) {
+		node_handle = node_param->resolve(get_blackboard());
+	}
+	_prepare_inputs();
 	parse();
 	ERR_FAIL_COND_MSG(is_parsed != Error::OK, "BTEvaluateExpression: Failed to parse expression: " + expression->get_error_text());
 }
 
+void BTEvaluateExpression::_prepare_inputs() {
+	processed_input_values.resize(input_values.size() + int(input_include_delta));
+	input_handles.resize(input_values.size());
+	dynamic_inputs.clear();
+	const Callable mark_dirty = callable_mp(this, &BTEvaluateExpression::_mark_inputs_dirty);
+	for (int i = 0; i < input_values.size(); i++) {
+		Ref<BBVariant> bb_variant = input_values[i];
+		if (bb_variant.is_valid() && !bb_variant->is_connected(LW_NAME(changed), mark_dirty)) {
+			// * Params may be changed at runtime, e.g. with BBVariant.set_saved_value().
+			bb_variant->connect(LW_NAME(changed), mark_dirty);
+		}
+		if (bb_variant.is_valid() && bb_variant->get_value_source() == BBParam::SAVED_VALUE) {
+			// * Saved values don't change between ticks.
+			processed_input_values[i + int(input_include_delta)] = bb_variant->get_value(get_scene_root(), get_blackboard());
+		} else {
+			if (bb_variant.is_valid()) {
+				input_handles[i] = bb_variant->resolve(get_blackboard());
+			}
+			dynamic_inputs.push_back(i);
+		}
+	}
+	inputs_dirty = false;
+}
+
 Error BTEvaluateExpression::parse() {
 	PackedStringArray processed_input_names;
 	processed_input_names.resize(input_names.size() + int(input_include_delta));
@@ -98,10 +164,64 @@ Error BTEvaluateExpression::parse() {
 		processed_input_names_ptr[i + int(input_include_delta)] = input_names[i];
 	}
 
-	is_parsed = expression->parse(expression_string, processed_input_names);
+	const String key = String(",").join(processed_input_names) + ":" + expression_string;
+	_release_cached_expression();
+	_lock_expression_cache();
+	CachedExpression *cached = expression_cache.getptr(key);
+	if (cached == nullptr) {
+		CachedExpression entry;
+		entry.expression.instantiate();
+		entry.error = entry.expression->parse(expression_string, processed_input_names);
+		cached = &expression_cache.insert(key, entry)->value;
+	}
+	cached->users += 1;
+	expression = cached->expression;
+	is_parsed = cached->error;
+	_unlock_expression_cache();
+	cache_key = key;
 	return is_parsed;
 }
 
+void BTEvaluateExpression::_release_cached_expression() {
+	if (cache_key.is_empty()) {
+		return;
+	}
+#ifdef LIMBOAI_GDEXTENSION
+	if (expression_cache_mutex.is_null()) {
+		return; // Cache is already finalized.
+	}
+#endif
+	_lock_expression_cache();
+	CachedExpression *cached = expression_cache.getptr(cache_key);
+	if (cached && --cached->users == 0) {
+		expression_cache.erase(cache_key);
+	}
+	_unlock_expression_cache();
+	cache_key = String();
+}
+
+int BTEvaluateExpression::get_expression_cache_size() {
+	_lock_expression_cache();
+	int size = expression_cache.size();
+	_unlock_expression_cache();
+	return size;
+}
+
+void BTEvaluateExpression::initialize_expression_cache() {
+#ifdef LIMBOAI_GDEXTENSION
+	expression_cache_mutex.instantiate();
+#endif
+}
+
+void BTEvaluateExpression::finalize_expression_cache() {
+	_lock_expression_cache();
+	expression_cache.clear();
+	_unlock_expression_cache();
+#ifdef LIMBOAI_GDEXTENSION
+	expression_cache_mutex.unref();
+#endif
+}
+
 String BTEvaluateExpression::_generate_name() {
 	return vformat("EvaluateExpression %s  node: %s  %s",
 			!expression_string.is_empty() ? expression_string : "???",
@@ -112,16 +232,20 @@ String BTEvaluateExpression::_generate_name() {
 BT::Status BTEvaluateExpression::_tick(double p_delta) {
 	ERR_FAIL_COND_V_MSG(expression_string.is_empty(), FAILURE, "BTEvaluateExpression: Expression String is not set.");
 	ERR_FAIL_COND_V_MSG(node_param.is_null(), FAILURE, "BTEvaluateExpression: Node parameter is not set.");
-	Object *obj = node_param->get_value(get_scene_root(), get_blackboard());
+	Object *obj = node_param->get_value_by_handle(get_scene_root(), get_blackboard(), node_handle);
 	ERR_FAIL_COND_V_MSG(obj == nullptr, FAILURE, "BTEvaluateExpression: Failed to get object: " + node_param->to_string());
 	ERR_FAIL_COND_V_MSG(is_parsed != Error::OK, FAILURE, "BTEvaluateExpression: Failed to parse expression: " + expression->get_error_text());
 
+	if (unlikely(inputs_dirty)) {
+		_prepare_inputs(); // Inputs were changed after setup.
+	}
 	if (input_include_delta) {
 		processed_input_values[0] = p_delta;
 	}
-	for (int i = 0; i < input_values.size(); ++i) {
-		const Ref<BBVariant> &bb_variant = input_values[i];
-		processed_input_values[i + int(input_include_delta)] = bb_variant->get_value(get_scene_root(), get_blackboard());
+	for (uint32_t i = 0; i < dynamic_inputs.size(); ++i) {
+		const int idx = dynamic_inputs[i];
+		const Ref<BBVariant> &bb_variant = input_values[idx];
+		processed_input_values[idx + int(input_include_delta)] = bb_variant->get_value_by_handle(get_scene_root(), get_blackboard(), input_handles[idx]);
 	}
 
 	Variant result = expression->execute(processed_input_values, obj, false);
@@ -161,5 +285,8 @@ void BTEvaluateExpression::_bind_methods() {
 }
 
 BTEvaluateExpression::BTEvaluateExpression() {
-	expression.instantiate();
+}
+
+BTEvaluateExpression::~BTEvaluateExpression() {
+	_release_cached_expression();
 }
@@ -30,7 +30,10 @@ class BTEvaluateExpression : public BTAction {
 	TASK_CATEGORY(Utility);
 
 private:
+	// Shared with other tasks through the expression cache. Expression::execute() writes its error state,
+	// so the shared object must only be used from one thread at a time; this task is not thread-safe.
 	Ref<Expression> expression;
+	String cache_key; // Key of the cache entry in use; empty if none.
 	Error is_parsed = FAILED;
 	Ref<BBNode> node_param;
 	String expression_string;
@@ -38,8 +41,16 @@ private:
 	TypedArray<BBVariant> input_values;
 	bool input_include_delta = false;
 	Array processed_input_values;
+	BBParamHandle node_handle;
+	LocalVector<BBParamHandle> input_handles;
+	LocalVector<int> dynamic_inputs; // Inputs read from the blackboard; saved values are assigned in _prepare_inputs().
+	bool inputs_dirty = true; // Set when inputs or their params change; see _mark_inputs_dirty().
 	StringName result_var;
 
+	void _prepare_inputs();
+	void _mark_inputs_dirty() { inputs_dirty = true; }
+	void _release_cached_expression();
+
 protected:
 	static void _bind_methods();
 
@@ -70,7 +81,12 @@ public:
 
 	virtual PackedStringArray get_configuration_warnings() override;
 
+	static void initialize_expression_cache();
+	static void finalize_expression_cache();
+	static int get_expression_cache_size();
+
 	BTEvaluateExpression();
+	~BTEvaluateExpression();
 };
 
 #endif // BT_EVALUATE_EXPRESSION_H
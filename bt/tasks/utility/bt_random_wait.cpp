@@ -25,12 +25,21 @@ void BTRandomWait::_enter() {
 
 BT::Status BTRandomWait::_tick(double p_delta) {
 	if (get_elapsed_time() < duration) {
+		request_sleep(duration - get_elapsed_time());
 		return RUNNING;
 	} else {
 		return SUCCESS;
 	}
 }
 
+void BTRandomWait::_save_state(const Ref<StreamPeerBuffer> &p_stream) const {
+	p_stream->put_double(duration);
+}
+
+void BTRandomWait::_load_state(const Ref<StreamPeerBuffer> &p_stream) {
+	duration = p_stream->get_double();
+}
+
 void BTRandomWait::set_min_duration(double p_max_duration) {
 	min_duration = p_max_duration;
 	if (max_duration < min_duration) {
@@ -17,6 +17,7 @@ String BTWait::_generate_name() {
 
 BT::Status BTWait::_tick(double p_delta) {
 	if (get_elapsed_time() < duration) {
+		request_sleep(duration - get_elapsed_time());
 		return RUNNING;
 	} else {
 		return SUCCESS;
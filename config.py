@@ -70,6 +70,7 @@ def get_doc_classes():
         "BTCallMethod",
         "BTEvaluateExpression",
         "BTCheckAgentProperty",
+        "BTCheckCondition",
         "BTCheckTrigger",
         "BTCheckVar",
         "BTComment",
@@ -84,6 +85,7 @@ def get_doc_classes():
         "BTFail",
         "BTForEach",
         "BTInstance",
+        "BTInstancePool",
         "BTInvert",
         "BTNewScope",
         "BTParallel",
@@ -99,6 +101,7 @@ def get_doc_classes():
         "BTRepeatUntilFailure",
         "BTRepeatUntilSuccess",
         "BTRunLimit",
+        "BTScheduler",
         "BTSelector",
         "BTSequence",
         "BTSetAgentProperty",
@@ -191,6 +191,11 @@ void BlackboardPlanEditor::_prefetching_toggled(bool p_toggle_on) {
 	plan->set_prefetch_nodepath_vars(p_toggle_on);
 }
 
+void BlackboardPlanEditor::_collection_sharing_toggled(bool p_toggle_on) {
+	ERR_FAIL_COND(plan.is_null());
+	plan->set_share_collections(p_toggle_on);
+}
+
 void BlackboardPlanEditor::_drag_button_down(Control *p_row) {
 	drag_index = p_row->get_index();
 	drag_start = drag_index;
@@ -256,6 +261,7 @@ void BlackboardPlanEditor::_refresh() {
 	}
 
 	nodepath_prefetching->set_pressed(plan->is_prefetching_nodepath_vars());
+	collection_sharing->set_pressed(plan->is_sharing_collections());
 
 	TypedArray<StringName> names = plan->list_vars();
 	for (int i = 0; i < names.size(); i++) {
@@ -359,6 +365,7 @@ void BlackboardPlanEditor::_notification(int p_what) {
 			type_menu->connect(LW_NAME(id_pressed), callable_mp(this, &BlackboardPlanEditor::_type_chosen));
 			hint_menu->connect(LW_NAME(id_pressed), callable_mp(this, &BlackboardPlanEditor::_hint_chosen));
 			nodepath_prefetching->connect(LW_NAME(toggled), callable_mp(this, &BlackboardPlanEditor::_prefetching_toggled));
+			collection_sharing->connect(LW_NAME(toggled), callable_mp(this, &BlackboardPlanEditor::_collection_sharing_toggled));
 
 			for (int i = 0; i < PropertyHint::PROPERTY_HINT_MAX; i++) {
 				hint_menu->add_item(LimboUtility::get_singleton()->get_property_hint_text(PropertyHint(i)), i);
@@ -398,6 +405,12 @@ BlackboardPlanEditor::BlackboardPlanEditor() {
 	nodepath_prefetching->set_h_size_flags(Control::SIZE_EXPAND | Control::SIZE_SHRINK_END);
 	nodepath_prefetching->set_focus_mode(Control::FOCUS_NONE);
 
+	collection_sharing = memnew(CheckBox);
+	toolbar->add_child(collection_sharing);
+	collection_sharing->set_text(TTR("Read-only Collections"));
+	collection_sharing->set_tooltip_text(TTR("If checked, Array and Dictionary variables are shared between blackboards as read-only copies instead of being copied.\nModifying them in place fails until a new value is assigned."));
+	collection_sharing->set_focus_mode(Control::FOCUS_NONE);
+
 	{
 		// * Header
 		header_row = memnew(PanelContainer);
@@ -73,6 +73,7 @@ private:
 	VBoxContainer *rows_vbox;
 	Button *add_var_tool;
 	CheckBox *nodepath_prefetching;
+	CheckBox *collection_sharing;
 	PanelContainer *header_row;
 	ScrollContainer *scroll_container;
 	PopupMenu *type_menu;
@@ -92,6 +93,7 @@ private:
 	void _hint_chosen(int id);
 	void _add_var_pressed();
 	void _prefetching_toggled(bool p_toggle_on);
+	void _collection_sharing_toggled(bool p_toggle_on);
 
 	void _drag_button_down(Control *p_row);
 	void _drag_button_up();
@@ -12,7 +12,7 @@
 #include "behavior_tree_data.h"
 
 #ifdef LIMBOAI_MODULE
-#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #endif
 
 //**** BehaviorTreeData
@@ -23,17 +23,11 @@ Array BehaviorTreeData::serialize(const Ref<BTInstance> &p_instance) {
 	arr.push_back(p_instance->get_owner_node() ? p_instance->get_owner_node()->get_path() : NodePath());
 	arr.push_back(p_instance->get_source_bt_path());
 
-	// Flatten tree into list depth first
-	List<Ref<BTTask>> stack;
-	stack.push_back(p_instance->get_root_task());
-	while (stack.size()) {
-		Ref<BTTask> task = stack.front()->get();
-		stack.pop_front();
-
-		int num_children = task->get_child_count();
-		for (int i = 0; i < num_children; i++) {
-			stack.push_front(task->get_child(num_children - 1 - i));
-		}
+	// Execution plan is already flattened depth first.
+	const LocalVector<BTInstance::PlanEntry> &plan = p_instance->get_execution_plan();
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		BTTask *task = plan[i].task.ptr();
+		int num_children = plan[i].num_children;
 
 		String script_path;
 		if (task->get_script()) {
@@ -90,17 +84,11 @@ Ref<BehaviorTreeData> BehaviorTreeData::create_from_bt_instance(const Ref<BTInst
 	data->node_owner_path = p_bt_instance->get_owner_node() ? p_bt_instance->get_owner_node()->get_path() : NodePath();
 	data->source_bt_path = p_bt_instance->get_source_bt_path();
 
-	// Flatten tree into list depth first
-	List<Ref<BTTask>> stack;
-	stack.push_back(p_bt_instance->get_root_task());
-	while (stack.size()) {
-		Ref<BTTask> task = stack.front()->get();
-		stack.pop_front();
-
-		int num_children = task->get_child_count();
-		for (int i = 0; i < num_children; i++) {
-			stack.push_front(task->get_child(num_children - 1 - i));
-		}
+	// Execution plan is already flattened depth first.
+	const LocalVector<BTInstance::PlanEntry> &plan = p_bt_instance->get_execution_plan();
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		BTTask *task = plan[i].task.ptr();
+		int num_children = plan[i].num_children;
 
 		String script_path;
 		if (task->get_script()) {
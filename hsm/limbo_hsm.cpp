@@ -11,6 +11,16 @@
 
 #include "limbo_hsm.h"
 
+#include "../bt/bt_scheduler.h"
+
+#ifdef LIMBOAI_MODULE
+#include "core/config/engine.h"
+#endif // LIMBOAI_MODULE
+
+#ifdef LIMBOAI_GDEXTENSION
+#include <godot_cpp/classes/engine.hpp>
+#endif // LIMBOAI_GDEXTENSION
+
 VARIANT_ENUM_CAST(LimboHSM::UpdateMode);
 
 void LimboHSM::set_active(bool p_active) {
@@ -22,14 +32,16 @@ void LimboHSM::set_active(bool p_active) {
 	}
 
 	active = p_active;
+	// HSMs running in the editor are not registered with the scheduler. See _update_scheduling().
+	bool use_scheduler = BTScheduler::get_singleton() && BTScheduler::get_singleton()->is_enabled() && !Engine::get_singleton()->is_editor_hint();
 	switch (update_mode) {
 		case UpdateMode::IDLE: {
-			set_process(p_active);
+			set_process(p_active && !use_scheduler);
 			set_physics_process(false);
 		} break;
 		case UpdateMode::PHYSICS: {
 			set_process(false);
-			set_physics_process(p_active);
+			set_physics_process(p_active && !use_scheduler);
 		} break;
 		case UpdateMode::MANUAL: {
 			set_process(false);
@@ -38,6 +50,7 @@ void LimboHSM::set_active(bool p_active) {
 	}
 	set_process_input(p_active);
 	set_process_unhandled_input(p_active);
+	_update_scheduling();
 
 	if (active) {
 		_enter();
@@ -101,6 +114,9 @@ void LimboHSM::update(double p_delta) {
 		change_active_state(next_active);
 		next_active = nullptr;
 	}
+	if (is_root() && blackboard.is_valid()) {
+		blackboard->dispatch_var_changes();
+	}
 }
 
 void LimboHSM::add_transition(LimboState *p_from_state, LimboState *p_to_state, const StringName &p_event, const Callable &p_guard) {
@@ -262,12 +278,35 @@ void LimboHSM::_initialize(Node *p_agent, const Ref<Blackboard> &p_blackboard) {
 }
 
 void LimboHSM::_validate_property(PropertyInfo &p_property) const {
-	if (p_property.name == LW_NAME(update_mode) && !is_root()) {
-		// Hide update_mode for non-root HSMs.
+	if ((p_property.name == LW_NAME(update_mode) || p_property.name == LW_NAME(lod_enabled)) && !is_root()) {
+		// Hide update_mode and lod_enabled for non-root HSMs.
 		p_property.usage = PROPERTY_USAGE_NONE;
 	}
 }
 
+void LimboHSM::set_lod_enabled(bool p_lod_enabled) {
+	lod_enabled = p_lod_enabled;
+	if (scheduled) {
+		BTScheduler::get_singleton()->set_client_lod_enabled(this, lod_enabled);
+	}
+}
+
+void LimboHSM::_update_scheduling() {
+	BTScheduler *scheduler = BTScheduler::get_singleton();
+	if (scheduler == nullptr || !scheduler->is_enabled() || Engine::get_singleton()->is_editor_hint()) {
+		return;
+	}
+	// Nested HSMs are updated by their parent state machine.
+	bool should_schedule = active && is_root() && update_mode != UpdateMode::MANUAL && is_inside_tree();
+	if (should_schedule && (!scheduled || scheduled_mode != update_mode)) {
+		scheduler->add_hsm(this, update_mode == UpdateMode::PHYSICS, lod_enabled);
+	} else if (!should_schedule && scheduled) {
+		scheduler->remove_client(this);
+	}
+	scheduled = should_schedule;
+	scheduled_mode = update_mode;
+}
+
 void LimboHSM::_exit_if_not_inside_tree() {
 	if (is_active() && !is_inside_tree()) {
 		_exit();
@@ -282,8 +321,13 @@ void LimboHSM::_notification(int p_what) {
 				// Typically, this happens when the node is re-entered scene repeatedly (such as with object pooling).
 				set_active(true);
 			}
+			_update_scheduling();
 		} break;
 		case NOTIFICATION_EXIT_TREE: {
+			if (scheduled) {
+				BTScheduler::get_singleton()->remove_client(this);
+				scheduled = false;
+			}
 			if (is_root()) {
 				// Exit the state machine if the root HSM is no longer in the scene tree (except when being reparented).
 				// This ensures that resources and signal connections are released if active.
@@ -323,6 +367,8 @@ void LimboHSM::_notification(int p_what) {
 void LimboHSM::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_update_mode", "mode"), &LimboHSM::set_update_mode);
 	ClassDB::bind_method(D_METHOD("get_update_mode"), &LimboHSM::get_update_mode);
+	ClassDB::bind_method(D_METHOD("set_lod_enabled", "enable"), &LimboHSM::set_lod_enabled);
+	ClassDB::bind_method(D_METHOD("get_lod_enabled"), &LimboHSM::get_lod_enabled);
 
 	ClassDB::bind_method(D_METHOD("set_initial_state", "state"), &LimboHSM::set_initial_state);
 	ClassDB::bind_method(D_METHOD("get_initial_state"), &LimboHSM::get_initial_state);
@@ -344,6 +390,7 @@ void LimboHSM::_bind_methods() {
 	BIND_ENUM_CONSTANT(MANUAL);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "update_mode", PROPERTY_HINT_ENUM, "Idle, Physics, Manual"), "set_update_mode", "get_update_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_enabled"), "set_lod_enabled", "get_lod_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "ANYSTATE", PROPERTY_HINT_RESOURCE_TYPE, "LimboState", 0), "", "anystate");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "initial_state", PROPERTY_HINT_RESOURCE_TYPE, "LimboState", 0), "set_initial_state", "get_initial_state");
 
@@ -359,3 +406,9 @@ LimboHSM::LimboHSM() {
 	next_active = nullptr;
 	initial_state = nullptr;
 }
+
+LimboHSM::~LimboHSM() {
+	if (scheduled && BTScheduler::get_singleton()) {
+		BTScheduler::get_singleton()->remove_client(this);
+	}
+}
@@ -18,6 +18,7 @@
 
 class LimboHSM : public LimboState {
 	GDCLASS(LimboHSM, LimboState);
+	friend class BTScheduler;
 
 public:
 	enum UpdateMode : unsigned int {
@@ -59,11 +60,15 @@ private:
 	LimboState *next_active;
 	bool updating = false;
 	bool was_active = false;
+	bool lod_enabled = false;
+	bool scheduled = false;
+	UpdateMode scheduled_mode = UpdateMode::PHYSICS;
 
 	HashMap<TransitionKey, Transition, TransitionKeyHasher> transitions;
 
 	void _get_transition(LimboState *p_from_state, const StringName &p_event, Transition &r_transition) const;
 	void _exit_if_not_inside_tree();
+	void _update_scheduling();
 
 protected:
 	static void _bind_methods();
@@ -79,9 +84,15 @@ protected:
 	virtual void _update(double p_delta) override;
 
 public:
-	void set_update_mode(UpdateMode p_mode) { update_mode = p_mode; }
+	void set_update_mode(UpdateMode p_mode) {
+		update_mode = p_mode;
+		_update_scheduling();
+	}
 	UpdateMode get_update_mode() const { return update_mode; }
 
+	void set_lod_enabled(bool p_lod_enabled);
+	bool get_lod_enabled() const { return lod_enabled; }
+
 	void set_active(bool p_active);
 
 	void change_active_state(LimboState *p_state);
@@ -104,6 +115,7 @@ public:
 	LimboState *anystate() const { return nullptr; }
 
 	LimboHSM();
+	~LimboHSM();
 };
 
 #endif // LIMBO_HSM_H
@@ -49,8 +49,11 @@
 #include "blackboard/blackboard.h"
 #include "blackboard/blackboard_plan.h"
 #include "bt/behavior_tree.h"
+#include "bt/bt_instance_pool.h"
 #include "bt/bt_player.h"
+#include "bt/bt_scheduler.h"
 #include "bt/bt_state.h"
+#include "bt/tasks/blackboard/bt_check_condition.h"
 #include "bt/tasks/blackboard/bt_check_trigger.h"
 #include "bt/tasks/blackboard/bt_check_var.h"
 #include "bt/tasks/blackboard/bt_set_var.h"
@@ -95,6 +98,7 @@
 #include "bt/tasks/utility/bt_random_wait.h"
 #include "bt/tasks/utility/bt_wait.h"
 #include "bt/tasks/utility/bt_wait_ticks.h"
+#include "compat/project_settings.h"
 #include "editor/action_banner.h"
 #include "editor/blackboard_plan_editor.h"
 #include "editor/debugger/behavior_tree_data.h"
@@ -129,6 +133,7 @@ using namespace godot;
 #endif // LIMBOAI_GDEXTENSION
 
 static LimboUtility *_limbo_utility = nullptr;
+static BTScheduler *_bt_scheduler = nullptr;
 
 void initialize_limboai_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SCENE) {
@@ -142,6 +147,7 @@ void initialize_limboai_module(ModuleInitializationLevel p_level) {
 		LimboDebugger::initialize();
 
 		GDREGISTER_CLASS(LimboUtility);
+		GDREGISTER_CLASS(BTScheduler);
 		GDREGISTER_CLASS(Blackboard);
 		GDREGISTER_CLASS(BlackboardPlan);
 
@@ -152,36 +158,37 @@ void initialize_limboai_module(ModuleInitializationLevel p_level) {
 		GDREGISTER_ABSTRACT_CLASS(BTTask);
 		GDREGISTER_CLASS(BehaviorTree);
 		GDREGISTER_CLASS(BTInstance);
+		GDREGISTER_CLASS(BTInstancePool);
 		GDREGISTER_CLASS(BTPlayer);
 		GDREGISTER_CLASS(BTState);
 
-		LIMBO_REGISTER_TASK(BTComment);
+		LIMBO_REGISTER_PURE_TASK(BTComment);
 
 		GDREGISTER_CLASS(BTComposite);
-		LIMBO_REGISTER_TASK(BTSequence);
-		LIMBO_REGISTER_TASK(BTSelector);
-		LIMBO_REGISTER_TASK(BTParallel);
-		LIMBO_REGISTER_TASK(BTDynamicSequence);
-		LIMBO_REGISTER_TASK(BTDynamicSelector);
+		LIMBO_REGISTER_PURE_TASK(BTSequence);
+		LIMBO_REGISTER_PURE_TASK(BTSelector);
+		LIMBO_REGISTER_PURE_TASK(BTParallel);
+		LIMBO_REGISTER_PURE_TASK(BTDynamicSequence);
+		LIMBO_REGISTER_PURE_TASK(BTDynamicSelector);
 		LIMBO_REGISTER_TASK(BTProbabilitySelector);
 		LIMBO_REGISTER_TASK(BTRandomSequence);
 		LIMBO_REGISTER_TASK(BTRandomSelector);
 
 		GDREGISTER_CLASS(BTDecorator);
-		LIMBO_REGISTER_TASK(BTInvert);
-		LIMBO_REGISTER_TASK(BTAlwaysFail);
-		LIMBO_REGISTER_TASK(BTAlwaysSucceed);
-		LIMBO_REGISTER_TASK(BTDelay);
-		LIMBO_REGISTER_TASK(BTRepeat);
-		LIMBO_REGISTER_TASK(BTRepeatUntilFailure);
-		LIMBO_REGISTER_TASK(BTRepeatUntilSuccess);
-		LIMBO_REGISTER_TASK(BTRunLimit);
-		LIMBO_REGISTER_TASK(BTTimeLimit);
+		LIMBO_REGISTER_PURE_TASK(BTInvert);
+		LIMBO_REGISTER_PURE_TASK(BTAlwaysFail);
+		LIMBO_REGISTER_PURE_TASK(BTAlwaysSucceed);
+		LIMBO_REGISTER_PURE_TASK(BTDelay);
+		LIMBO_REGISTER_PURE_TASK(BTRepeat);
+		LIMBO_REGISTER_PURE_TASK(BTRepeatUntilFailure);
+		LIMBO_REGISTER_PURE_TASK(BTRepeatUntilSuccess);
+		LIMBO_REGISTER_PURE_TASK(BTRunLimit);
+		LIMBO_REGISTER_PURE_TASK(BTTimeLimit);
 		LIMBO_REGISTER_TASK(BTCooldown);
 		LIMBO_REGISTER_TASK(BTProbability);
-		LIMBO_REGISTER_TASK(BTForEach);
-		LIMBO_REGISTER_TASK(BTNewScope);
-		LIMBO_REGISTER_TASK(BTSubtree);
+		LIMBO_REGISTER_THREAD_SAFE_TASK(BTForEach);
+		LIMBO_REGISTER_THREAD_SAFE_TASK(BTNewScope);
+		LIMBO_REGISTER_THREAD_SAFE_TASK(BTSubtree);
 
 		GDREGISTER_CLASS(BTAction);
 		GDREGISTER_CLASS(BTCondition);
@@ -189,18 +196,19 @@ void initialize_limboai_module(ModuleInitializationLevel p_level) {
 		LIMBO_REGISTER_TASK(BTCallMethod);
 		LIMBO_REGISTER_TASK(BTEvaluateExpression);
 		LIMBO_REGISTER_TASK(BTConsolePrint);
-		LIMBO_REGISTER_TASK(BTFail);
+		LIMBO_REGISTER_PURE_TASK(BTFail);
 		LIMBO_REGISTER_TASK(BTPauseAnimation);
 		LIMBO_REGISTER_TASK(BTPlayAnimation);
 		LIMBO_REGISTER_TASK(BTRandomWait);
 		LIMBO_REGISTER_TASK(BTSetAgentProperty);
-		LIMBO_REGISTER_TASK(BTSetVar);
+		LIMBO_REGISTER_THREAD_SAFE_TASK(BTSetVar);
 		LIMBO_REGISTER_TASK(BTStopAnimation);
-		LIMBO_REGISTER_TASK(BTWait);
-		LIMBO_REGISTER_TASK(BTWaitTicks);
+		LIMBO_REGISTER_PURE_TASK(BTWait);
+		LIMBO_REGISTER_PURE_TASK(BTWaitTicks);
 		LIMBO_REGISTER_TASK(BTCheckAgentProperty);
-		LIMBO_REGISTER_TASK(BTCheckTrigger);
-		LIMBO_REGISTER_TASK(BTCheckVar);
+		LIMBO_REGISTER_TASK(BTCheckCondition);
+		LIMBO_REGISTER_THREAD_SAFE_TASK(BTCheckTrigger);
+		LIMBO_REGISTER_PURE_TASK(BTCheckVar);
 
 		GDREGISTER_ABSTRACT_CLASS(BBParam);
 		GDREGISTER_CLASS(BBAabb);
@@ -246,7 +254,17 @@ void initialize_limboai_module(ModuleInitializationLevel p_level) {
 		Engine::get_singleton()->register_singleton("LimboUtility", LimboUtility::get_singleton());
 #endif
 
+		_bt_scheduler = memnew(BTScheduler);
+
+#ifdef LIMBOAI_MODULE
+		Engine::get_singleton()->add_singleton(Engine::Singleton("BTScheduler", BTScheduler::get_singleton()));
+#elif LIMBOAI_GDEXTENSION
+		Engine::get_singleton()->register_singleton("BTScheduler", BTScheduler::get_singleton());
+#endif
+
 		LimboStringNames::create();
+		BTEvaluateExpression::initialize_expression_cache();
+		BTTask::set_share_bb_params(GLOBAL_DEF("limbo_ai/behavior_tree/share_bb_params_between_instances", false));
 	}
 
 #ifdef TOOLS_ENABLED
@@ -287,8 +305,10 @@ void initialize_limboai_module(ModuleInitializationLevel p_level) {
 void uninitialize_limboai_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SCENE) {
 		LimboDebugger::deinitialize();
+		BTEvaluateExpression::finalize_expression_cache();
 		LimboStringNames::free();
 		memdelete(_limbo_utility);
+		memdelete(_bt_scheduler);
 	}
 }
 
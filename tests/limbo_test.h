@@ -45,6 +45,13 @@ public:
 	int num_exits = 0;
 
 protected:
+	// * Bound as a property, so that clones made by BehaviorTree::instantiate() return the same status.
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_ret_status", "status"), &BTTestAction::set_ret_status);
+		ClassDB::bind_method(D_METHOD("get_ret_status"), &BTTestAction::get_ret_status);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "ret_status"), "set_ret_status", "get_ret_status");
+	}
+
 	virtual void _enter() override { num_entries += 1; }
 	virtual void _exit() override { num_exits += 1; }
 
@@ -54,6 +61,9 @@ protected:
 	}
 
 public:
+	void set_ret_status(Status p_status) { ret_status = p_status; }
+	Status get_ret_status() const { return ret_status; }
+
 	bool is_status_either(Status p_status1, Status p_status2) { return (get_status() == p_status1 || get_status() == p_status2); }
 
 	BTTestAction(Status p_return_status) { ret_status = p_return_status; }
@@ -69,6 +69,20 @@ TEST_CASE("[Modules][LimboAI] BBParam") {
 			CHECK(param->get_value(dummy, bb, "default_value") == Variant("default_value"));
 			ERR_PRINT_ON;
 		}
+		SUBCASE("With a handle") {
+			BBParamHandle handle = param->resolve(bb);
+			ERR_PRINT_OFF;
+			CHECK(param->get_value_by_handle(dummy, bb, handle, "default_value") == Variant("default_value"));
+			ERR_PRINT_ON;
+			bb->set_var("test_var", 123);
+			CHECK(param->get_value_by_handle(dummy, bb, handle) == Variant(123));
+			bb->set_var("test_var", 456);
+			CHECK(param->get_value_by_handle(dummy, bb, handle) == Variant(456));
+
+			bb->set_var("other_var", "test");
+			param->set_variable("other_var");
+			CHECK(param->get_value_by_handle(dummy, bb, handle) == Variant("test"));
+		}
 	}
 
 	memdelete(dummy);
@@ -89,6 +103,23 @@ TEST_CASE("[Modules][LimboAI] BBNode") {
 		CHECK(param->get_value(dummy, bb).get_type() == Variant::Type::OBJECT);
 		CHECK(param->get_value(dummy, bb) == Variant(other));
 	}
+	SUBCASE("With a handle") {
+		param->set_value_source(BBParam::SAVED_VALUE);
+		param->set_saved_value(NodePath("./Other"));
+		BBParamHandle handle = param->resolve(bb);
+		CHECK(param->get_value_by_handle(dummy, bb, handle) == Variant(other));
+		CHECK(handle.node_id == ObjectID(other->get_instance_id()));
+		CHECK(param->get_value_by_handle(dummy, bb, handle) == Variant(other));
+
+		// * Cached node is dropped after it's freed.
+		memdelete(other);
+		CHECK(param->get_value_by_handle(dummy, bb, handle).is_null());
+		Node *replacement = memnew(Node);
+		replacement->set_name("Other");
+		dummy->add_child(replacement);
+		CHECK(param->get_value_by_handle(dummy, bb, handle) == Variant(replacement));
+		other = replacement;
+	}
 	SUBCASE("With an invalid path") {
 		param->set_value_source(BBParam::SAVED_VALUE);
 		param->set_saved_value(NodePath("./SomeOther"));
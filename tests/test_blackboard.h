@@ -145,6 +145,27 @@ TEST_CASE("[Modules][LimboAI] Test Blackboard") {
 		CHECK_EQ(blackboard->get_var("a", not_found), Variant(1));
 	}
 
+	SUBCASE("Test scope cache") {
+		Ref<Blackboard> parent_scope = memnew(Blackboard);
+		Ref<Blackboard> grand_parent_scope = memnew(Blackboard);
+		blackboard->set_parent(parent_scope);
+		parent_scope->set_parent(grand_parent_scope);
+
+		CHECK_FALSE(blackboard->has_var("x")); // * Miss is cached.
+		grand_parent_scope->set_var("x", 1);
+		CHECK_EQ(blackboard->get_var("x", not_found), Variant(1)); // * Cache invalidated on creation.
+
+		parent_scope->set_var("x", 2);
+		CHECK_EQ(blackboard->get_var("x", not_found), Variant(2)); // * Nearest scope wins.
+		parent_scope->set_var("x", 3);
+		CHECK_EQ(blackboard->get_var("x", not_found), Variant(3)); // * Cached entry shares storage.
+
+		parent_scope->erase_var("x");
+		CHECK_EQ(blackboard->get_var("x", not_found), Variant(1));
+		grand_parent_scope->erase_var("x");
+		CHECK_FALSE(blackboard->has_var("x"));
+	}
+
 	SUBCASE("Test binding") {
 		Ref<TestPropertyHolder> holder = memnew(TestPropertyHolder);
 		blackboard->bind_var_to_property("a", holder.ptr(), "property");
@@ -158,6 +179,16 @@ TEST_CASE("[Modules][LimboAI] Test Blackboard") {
 		blackboard->set_var("a", Variant(7));
 		CHECK_EQ(holder->get_property(), 6);
 		CHECK_EQ(blackboard->get_var("a", not_found), Variant(7));
+
+		// * Rebinding resolves the property accessors again.
+		Ref<TestPropertyHolder> other_holder = memnew(TestPropertyHolder);
+		blackboard->bind_var_to_property("a", holder.ptr(), "property");
+		blackboard->bind_var_to_property("a", other_holder.ptr(), "property");
+		blackboard->set_var("a", Variant(8));
+		CHECK_EQ(holder->get_property(), 6);
+		CHECK_EQ(other_holder->get_property(), 8);
+		other_holder->set_property(9);
+		CHECK_EQ(blackboard->get_var("a", not_found), Variant(9));
 	}
 
 	SUBCASE("Test linking") {
@@ -179,6 +210,256 @@ TEST_CASE("[Modules][LimboAI] Test Blackboard") {
 		CHECK_EQ(blackboard->get_var("a", not_found), Variant(333));
 		CHECK_EQ(target_blackboard->get_var("aa", not_found), Variant(333));
 	}
+
+	SUBCASE("Test handles") {
+		BBVarHandle handle_a = blackboard->resolve_var("a");
+		CHECK(blackboard->has_var_by_handle(handle_a));
+		CHECK_EQ(blackboard->get_var_by_handle(handle_a, not_found), Variant(1));
+
+		blackboard->set_var_by_handle(handle_a, 10);
+		CHECK_EQ(blackboard->get_var("a", not_found), Variant(10));
+		blackboard->set_var("a", 11);
+		CHECK_EQ(blackboard->get_var_by_handle(handle_a, not_found), Variant(11));
+
+		BBVarHandle handle_d = blackboard->resolve_var("d");
+		CHECK_FALSE(blackboard->has_var_by_handle(handle_d));
+		CHECK_EQ(blackboard->get_var_by_handle(handle_d, not_found, false), not_found);
+		blackboard->set_var_by_handle(handle_d, 4); // * Creates the variable, like set_var().
+		CHECK_EQ(blackboard->get_var("d", not_found), Variant(4));
+		CHECK_EQ(blackboard->get_var_by_handle(handle_d, not_found), Variant(4));
+
+		// * Handles resolve through parent scopes and follow layout changes.
+		Ref<Blackboard> parent_scope = memnew(Blackboard);
+		parent_scope->set_var("e", 5);
+		blackboard->set_parent(parent_scope);
+		BBVarHandle handle_e = blackboard->resolve_var("e");
+		CHECK_EQ(blackboard->get_var_by_handle(handle_e, not_found), Variant(5));
+		blackboard->set_var_by_handle(handle_e, 6); // * Writes to the current scope, like set_var().
+		CHECK_EQ(parent_scope->get_var("e", not_found), Variant(5));
+		CHECK_EQ(blackboard->get_var_by_handle(handle_e, not_found), Variant(6));
+		blackboard->erase_var("e");
+		CHECK_EQ(blackboard->get_var_by_handle(handle_e, not_found), Variant(5));
+
+		blackboard->erase_var("a");
+		CHECK_FALSE(blackboard->has_var_by_handle(handle_a));
+	}
+
+	SUBCASE("Test handles aren't invalidated by unrelated blackboards") {
+		Ref<Blackboard> parent_scope = memnew(Blackboard);
+		parent_scope->set_var("e", 5);
+		blackboard->set_parent(parent_scope);
+		BBVarHandle handle_a = blackboard->resolve_var("a");
+		BBVarHandle handle_e = blackboard->resolve_var("e");
+
+		// * Substitute the resolved variables to detect re-resolution.
+		BBVariable marker(Variant::INT);
+		marker.set_value(42);
+		handle_a.var = marker;
+		handle_e.var = marker;
+
+		Ref<Blackboard> unrelated = memnew(Blackboard);
+		unrelated->set_var("z", 0);
+		parent_scope->set_var("unrelated", 0); // * Above the scope where "a" was found.
+		CHECK_EQ(blackboard->get_var_by_handle(handle_a, not_found), Variant(42));
+		CHECK_EQ(blackboard->get_var_by_handle(handle_e, not_found), Variant(5)); // * Resolved through the changed scope.
+	}
+
+	SUBCASE("Test typed access") {
+		BBVarHandle handle_a = blackboard->resolve_var("a");
+		CHECK_EQ(blackboard->get_typed_by_handle<int64_t>(handle_a, -1), 1);
+		blackboard->set_typed_by_handle<int64_t>(handle_a, 2);
+		CHECK_EQ(blackboard->get_var("a", not_found), Variant(2));
+
+		// * Falls back to Variant conversion on type mismatch.
+		CHECK_EQ(blackboard->get_typed_by_handle<double>(handle_a, -1.0), 2.0);
+		blackboard->set_typed_by_handle<double>(handle_a, 3.5);
+		CHECK_EQ(blackboard->get_var("a", not_found), Variant(3.5));
+
+		BBVarHandle handle_d = blackboard->resolve_var("d");
+		CHECK_EQ(blackboard->get_typed_by_handle<bool>(handle_d, true), true);
+		blackboard->set_typed_by_handle<Vector2>(handle_d, Vector2(1, 2)); // * Creates the variable.
+		CHECK_EQ(blackboard->get_typed_by_handle<Vector2>(handle_d), Vector2(1, 2));
+	}
+
+	SUBCASE("Test duplicated variables share property info") {
+		BBVariable var(Variant::INT, PROPERTY_HINT_RANGE, "0,10");
+		BBVariable dup = var.duplicate();
+		CHECK(dup.is_same_prop_info(var));
+		dup.set_hint_string("0,20");
+		CHECK_EQ(var.get_hint_string(), "0,10");
+		CHECK_EQ(dup.get_hint_string(), "0,20");
+		CHECK_EQ(dup.get_hint(), PROPERTY_HINT_RANGE);
+
+		BBVariable plain(Variant::INT);
+		CHECK_EQ(plain.get_hint(), PROPERTY_HINT_NONE);
+		CHECK(plain.get_hint_string().is_empty());
+		CHECK_FALSE(plain.is_bound());
+	}
+
+	SUBCASE("Test deferred duplication") {
+		Array table;
+		table.push_back(1);
+		BBVariable planned(Variant::ARRAY);
+		planned.set_value(table);
+
+		BBVariable copy = planned.duplicate_deferred();
+		Array copy_table = copy.get_value();
+		copy_table.push_back(2);
+		CHECK_EQ(table.size(), 1); // * Materialized on first access.
+		CHECK_EQ(Array(copy.get_value()).size(), 2);
+
+		// * Opt-in: copies share a single read-only copy of the planned value.
+		BBVariable shared = planned.duplicate_deferred(true);
+		BBVariable other_shared = planned.duplicate_deferred(true);
+		Array shared_table = shared.get_value();
+		CHECK(shared_table.is_read_only());
+		CHECK_EQ(shared_table.id(), Array(other_shared.get_value()).id());
+		ERR_PRINT_OFF;
+		shared_table.push_back(2);
+		ERR_PRINT_ON;
+		CHECK_EQ(table.size(), 1);
+		CHECK_EQ(Array(shared.get_value()).size(), 1);
+		CHECK_FALSE(table.is_read_only());
+
+		// * The first write replaces the shared value.
+		Array written = shared_table.duplicate();
+		written.push_back(2);
+		shared.set_value(written);
+		CHECK_FALSE(Array(shared.get_value()).is_read_only());
+		CHECK_EQ(Array(shared.get_value()).size(), 2);
+		CHECK_EQ(Array(other_shared.get_value()).size(), 1);
+
+		BBVariable overwritten = planned.duplicate_deferred();
+		overwritten.set_value(Array());
+		CHECK_EQ(Array(overwritten.get_value()).size(), 0);
+		CHECK_EQ(table.size(), 1);
+
+		PackedInt32Array packed;
+		packed.push_back(1);
+		BBVariable planned_packed(Variant::PACKED_INT32_ARRAY);
+		planned_packed.set_value(packed);
+		BBVariable packed_copy = planned_packed.duplicate_deferred();
+		Variant packed_value = packed_copy.get_value();
+		packed_value.call("push_back", 2); // * Modifies the packed array in place, as scripts do.
+		CHECK_EQ(PackedInt32Array(packed_copy.get_value()).size(), 2);
+		CHECK_EQ(PackedInt32Array(planned_packed.get_value()).size(), 1);
+	}
+
+	SUBCASE("Test snapshot") {
+		Ref<Blackboard> parent_scope = memnew(Blackboard);
+		parent_scope->set_var("p", 10);
+		blackboard->set_parent(parent_scope);
+		blackboard->link_var("c", parent_scope, "p");
+		Array arr;
+		arr.push_back(1);
+		blackboard->set_var("arr", arr);
+
+		PackedByteArray snapshot = blackboard->save_snapshot();
+		CHECK_FALSE(snapshot.is_empty());
+
+		Ref<Blackboard> restored_parent = memnew(Blackboard);
+		Ref<Blackboard> restored = memnew(Blackboard);
+		restored->set_parent(restored_parent);
+		restored->set_var("extra", 1);
+		restored->load_snapshot(snapshot);
+
+		CHECK_EQ(restored->get_var("a", not_found), Variant(1));
+		CHECK_EQ(restored->get_var("b", not_found), Variant(Vector2(2, 2)));
+		CHECK_EQ(restored->get_var("arr", not_found), Variant(arr));
+		CHECK_EQ(restored_parent->get_var("p", not_found), Variant(10));
+		CHECK_FALSE(restored->has_local_var("extra"));
+
+		// * Links are restored.
+		restored->set_var("c", 11);
+		CHECK_EQ(restored_parent->get_var("p", not_found), Variant(11));
+
+		// * Scope chain must match.
+		ERR_PRINT_OFF;
+		Ref<Blackboard> mismatched = memnew(Blackboard);
+		mismatched->load_snapshot(snapshot);
+		ERR_PRINT_ON;
+		CHECK_FALSE(mismatched->has_var("a"));
+
+		// * Corrupted data leaves the blackboards untouched.
+		PackedByteArray truncated = snapshot.slice(0, snapshot.size() - 1);
+		Ref<Blackboard> untouched_parent = memnew(Blackboard);
+		Ref<Blackboard> untouched = memnew(Blackboard);
+		untouched->set_parent(untouched_parent);
+		untouched->set_var("extra", 1);
+		ERR_PRINT_OFF;
+		untouched->load_snapshot(truncated);
+		ERR_PRINT_ON;
+		CHECK(untouched->has_local_var("extra"));
+		CHECK_FALSE(untouched->has_var("a"));
+		CHECK_FALSE(untouched_parent->has_var("p"));
+	}
+
+	SUBCASE("Test snapshot keeps bindings") {
+		Node *node = memnew(Node);
+		node->set_name("Bound");
+		blackboard->bind_var_to_property("a", node, "name");
+		PackedByteArray snapshot = blackboard->save_snapshot();
+
+		blackboard->set_var("b", Vector2(5, 5));
+		blackboard->load_snapshot(snapshot);
+		CHECK_EQ(blackboard->get_var("a", not_found), Variant(StringName("Bound")));
+		CHECK_EQ(blackboard->get_var("b", not_found), Variant(Vector2(2, 2)));
+		memdelete(node);
+	}
+
+	SUBCASE("Test snapshot restores values into own storage") {
+		PackedByteArray snapshot = blackboard->save_snapshot();
+
+		// * Variables linked or bound after saving must not write through on load.
+		Ref<Blackboard> other = memnew(Blackboard);
+		other->set_var("aa", 100);
+		blackboard->link_var("a", other, "aa");
+		Ref<TestPropertyHolder> holder = memnew(TestPropertyHolder);
+		holder->set_property(200);
+		blackboard->bind_var_to_property("b", holder.ptr(), "property");
+
+		blackboard->load_snapshot(snapshot);
+		CHECK_EQ(blackboard->get_var("a", not_found), Variant(1));
+		CHECK_EQ(blackboard->get_var("b", not_found), Variant(Vector2(2, 2)));
+		CHECK_EQ(other->get_var("aa", not_found), Variant(100));
+		CHECK_EQ(holder->get_property(), 200);
+		CHECK_FALSE(blackboard->has_external_vars());
+
+		blackboard->set_var("a", 2);
+		CHECK_EQ(other->get_var("aa", not_found), Variant(100));
+	}
+
+	SUBCASE("Test change notifications") {
+		uint32_t version = blackboard->get_var_version("a");
+		blackboard->set_var("a", 2);
+		CHECK_EQ(blackboard->get_var_version("a"), version + 1);
+		CHECK_EQ(blackboard->get_var_version("d"), 0);
+
+		Ref<CallbackCounter> counter = memnew(CallbackCounter);
+		Callable callback = callable_mp(counter.ptr(), &CallbackCounter::callback).unbind(2);
+		blackboard->subscribe_var("a", callback);
+		blackboard->subscribe_var("d", callback);
+		blackboard->dispatch_var_changes();
+		CHECK_EQ(counter->num_callbacks, 0);
+
+		// * Notifications are batched: one call per changed variable.
+		blackboard->set_var("a", 3);
+		blackboard->set_var("a", 4);
+		blackboard->set_var("b", 5);
+		blackboard->dispatch_var_changes();
+		CHECK_EQ(counter->num_callbacks, 1);
+		blackboard->dispatch_var_changes();
+		CHECK_EQ(counter->num_callbacks, 1);
+
+		blackboard->set_var("d", 6); // * Creating a variable is a change.
+		blackboard->dispatch_var_changes();
+		CHECK_EQ(counter->num_callbacks, 2);
+
+		blackboard->unsubscribe_var("a", callback);
+		blackboard->set_var("a", 7);
+		blackboard->dispatch_var_changes();
+		CHECK_EQ(counter->num_callbacks, 2);
+	}
 }
 
 } //namespace TestBlackboard
@@ -19,11 +19,67 @@
 #include "modules/limboai/bt/tasks/bt_task.h"
 #include "modules/limboai/bt/tasks/utility/bt_call_method.h"
 
+#include "core/object/script_language.h"
 #include "core/os/memory.h"
 #include "core/variant/array.h"
 
 namespace TestCallMethod {
 
+// Native class with a method of the same name as CallbackCounter, but a different method bind.
+class OtherCallbackTarget : public RefCounted {
+	GDCLASS(OtherCallbackTarget, RefCounted);
+
+public:
+	int num_callbacks = 0;
+
+	void callback() { num_callbacks += 1; }
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("callback"), &OtherCallbackTarget::callback);
+	}
+};
+
+// Stands in for a script attached to the target that overrides "callback".
+class OverridingScriptInstance : public ScriptInstance {
+public:
+	int num_overridden_calls = 0;
+
+	bool set(const StringName &p_name, const Variant &p_value) override { return false; }
+	bool get(const StringName &p_name, Variant &r_ret) const override { return false; }
+	void get_property_list(List<PropertyInfo> *p_properties) const override {}
+	Variant::Type get_property_type(const StringName &p_name, bool *r_is_valid) const override {
+		if (r_is_valid) {
+			*r_is_valid = false;
+		}
+		return Variant::NIL;
+	}
+	void validate_property(PropertyInfo &p_property) const override {}
+	bool property_can_revert(const StringName &p_name) const override { return false; }
+	bool property_get_revert(const StringName &p_name, Variant &r_ret) const override { return false; }
+	void get_method_list(List<MethodInfo> *p_list) const override {}
+	bool has_method(const StringName &p_method) const override { return p_method == StringName("callback"); }
+	int get_method_argument_count(const StringName &p_method, bool *r_is_valid = nullptr) const override {
+		if (r_is_valid) {
+			*r_is_valid = has_method(p_method);
+		}
+		return 0;
+	}
+	Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override {
+		if (p_method == StringName("callback")) {
+			num_overridden_calls += 1;
+			r_error.error = Callable::CallError::CALL_OK;
+		} else {
+			r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		}
+		return Variant();
+	}
+	void notification(int p_notification, bool p_reversed = false) override {}
+	Ref<Script> get_script() const override { return Ref<Script>(); }
+	const Variant get_rpc_config() const override { return Variant(); }
+	ScriptLanguage *get_language() override { return nullptr; }
+};
+
 TEST_CASE("[Modules][LimboAI] BTCallMethod") {
 	Ref<BTCallMethod> cm = memnew(BTCallMethod);
 
@@ -64,6 +120,40 @@ TEST_CASE("[Modules][LimboAI] BTCallMethod") {
 		SUBCASE("When method exists") {
 			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
 			CHECK(callback_counter->num_callbacks == 1);
+			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(callback_counter->num_callbacks == 2);
+		}
+		SUBCASE("When method is overridden by a script") {
+			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(callback_counter->num_callbacks == 1);
+
+			// * Native method bind is cached by now, but scripted targets go through callp().
+			OverridingScriptInstance *script_instance = memnew(OverridingScriptInstance);
+			callback_counter->set_script_instance(script_instance);
+			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(script_instance->num_overridden_calls == 1);
+			CHECK(callback_counter->num_callbacks == 1);
+		}
+		SUBCASE("When target class changes between ticks") {
+			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(callback_counter->num_callbacks == 1);
+
+			Ref<OtherCallbackTarget> other = memnew(OtherCallbackTarget);
+			bb->set_var("object", other);
+			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(other->num_callbacks == 1);
+			CHECK(callback_counter->num_callbacks == 1);
+
+			bb->set_var("object", callback_counter);
+			CHECK(cm->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(callback_counter->num_callbacks == 2);
+
+			// * Class without the method.
+			Ref<RefCounted> without_method = memnew(RefCounted);
+			bb->set_var("object", without_method);
+			ERR_PRINT_OFF;
+			CHECK(cm->execute(0.01666) == BTTask::FAILURE);
+			ERR_PRINT_ON;
 		}
 		SUBCASE("With arguments") {
 			cm->set_method("callback_delta");
@@ -0,0 +1,148 @@
+/**
+ * test_check_condition.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef TEST_CHECK_CONDITION_H
+#define TEST_CHECK_CONDITION_H
+
+#include "limbo_test.h"
+
+#include "modules/limboai/blackboard/blackboard.h"
+#include "modules/limboai/bt/tasks/blackboard/bt_check_condition.h"
+#include "modules/limboai/bt/tasks/bt_task.h"
+
+namespace TestCheckCondition {
+
+TEST_CASE("[Modules][LimboAI] BTCheckCondition") {
+	Ref<BTCheckCondition> cc = memnew(BTCheckCondition);
+	Ref<Blackboard> bb = memnew(Blackboard);
+	Node *agent = memnew(Node);
+	agent->set_name("Enemy");
+	agent->set_process_priority(3);
+	cc->initialize(agent, bb, agent);
+
+	SUBCASE("With empty condition") {
+		CHECK_FALSE(cc->is_condition_valid());
+		ERR_PRINT_OFF;
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+	}
+	SUBCASE("With invalid condition") {
+		cc->set_condition("$hp >");
+		CHECK_FALSE(cc->is_condition_valid());
+		ERR_PRINT_OFF;
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+
+		cc->set_condition("$hp = 1");
+		CHECK_FALSE(cc->is_condition_valid());
+		cc->set_condition("($hp > 1");
+		CHECK_FALSE(cc->is_condition_valid());
+	}
+	SUBCASE("With constants") {
+		cc->set_condition("1 + 2 * 3 == 7 && !(2 > 3)");
+		CHECK(cc->is_condition_valid());
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		cc->set_condition("10 / 4 == 2 and -1.5 < 0 and \"a\" != 'b'");
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		cc->set_condition("false || null");
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+	}
+	SUBCASE("With blackboard variables") {
+		cc->set_condition("$hp > 0 && ($ammo >= 1 || not $reloading)");
+		CHECK(cc->is_condition_valid());
+		bb->set_var("hp", 10);
+		bb->set_var("ammo", 0);
+		bb->set_var("reloading", false);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		bb->set_var("reloading", true);
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		bb->set_var("ammo", 2);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		bb->set_var("hp", 0);
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+
+		// * Operand types change between ticks.
+		bb->set_var("hp", 0.5);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		bb->set_var("hp", -0.5);
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		bb->set_var("hp", "string");
+		ERR_PRINT_OFF;
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+		bb->set_var("hp", 1);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+	}
+	SUBCASE("Short-circuit evaluation") {
+		cc->set_condition("$a || $missing");
+		bb->set_var("a", true);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		bb->set_var("a", false);
+		ERR_PRINT_OFF;
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+	}
+	SUBCASE("With arithmetic on variables") {
+		cc->set_condition("$x % 2 == 1 && $x * 2 - 1 == 5 && $y / 2.0 == 1.25");
+		bb->set_var("x", 3);
+		bb->set_var("y", 2.5);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		bb->set_var("x", 0);
+		cc->set_condition("1 / $x == 0");
+		ERR_PRINT_OFF;
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+	}
+	SUBCASE("With agent properties") {
+		cc->set_condition("name == \"Enemy\" && process_priority > 2");
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		agent->set_process_priority(1);
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+
+		cc->set_condition("not_found > 0");
+		ERR_PRINT_OFF;
+		CHECK(cc->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+	}
+	SUBCASE("Negation binds looser than comparisons") {
+		bb->set_var("a", 2);
+		cc->set_condition("not $a == 1");
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		cc->set_condition("!$a == 1 && not $a > 5");
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+		cc->set_condition("!($a == 2) || not not $a == 2");
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+	}
+	SUBCASE("Clones specialize independently") {
+		cc->set_condition("$hp * 2 > 1");
+		bb->set_var("hp", 1);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+
+		Ref<BTCheckCondition> other = cc->clone();
+		REQUIRE(other.is_valid());
+		CHECK(other->is_condition_valid());
+		Ref<Blackboard> other_bb = memnew(Blackboard);
+		other_bb->set_var("hp", 0.25);
+		other->initialize(agent, other_bb, agent);
+		CHECK(other->execute(0.01666) == BTTask::FAILURE);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+
+		other->set_condition("$hp < 1");
+		CHECK(other->execute(0.01666) == BTTask::SUCCESS);
+		CHECK(cc->execute(0.01666) == BTTask::SUCCESS);
+	}
+
+	memdelete(agent);
+}
+
+} //namespace TestCheckCondition
+
+#endif // TEST_CHECK_CONDITION_H
@@ -99,6 +99,22 @@ TEST_CASE("[Modules][LimboAI] BTCheckVar") {
 			TC_CHECK_VALUES(cv, "AAA", "AAC", 123, LimboUtility::CHECK_LESS_THAN, "AAB");
 			TC_CHECK_VALUES(cv, "AAA", "AAB", 123, LimboUtility::CHECK_NOT_EQUAL, "AAB");
 		}
+		SUBCASE("With operand types known at setup") {
+			bb->set_var("var", 5);
+			value->set_saved_value(3.5);
+			cv->set_check_type(LimboUtility::CHECK_GREATER_THAN);
+			cv->initialize(dummy, bb, dummy);
+			CHECK(cv->execute(0.01666) == BTTask::SUCCESS);
+			bb->set_var("var", 3);
+			CHECK(cv->execute(0.01666) == BTTask::FAILURE);
+			// * Falls back to Variant evaluation when types don't match.
+			bb->set_var("var", "5");
+			CHECK(cv->execute(0.01666) == BTTask::FAILURE);
+			bb->set_var("var", Vector2(1, 1));
+			value->set_saved_value(Vector2(1, 1));
+			cv->set_check_type(LimboUtility::CHECK_EQUAL);
+			CHECK(cv->execute(0.01666) == BTTask::SUCCESS);
+		}
 	}
 
 	memdelete(dummy);
@@ -48,7 +48,22 @@ TEST_CASE("[Modules][LimboAI] BTEvaluateExpression") {
 
 		ee->initialize(dummy, bb, dummy);
 
-		SUBCASE("When expression string is empty") {
+		SUBCASE("Cached expressions are released by their last user") {
+			int cache_size = BTEvaluateExpression::get_expression_cache_size();
+			Ref<BTEvaluateExpression> other = memnew(BTEvaluateExpression);
+			other->set_expression_string("callback() + 1");
+			CHECK(other->parse() == OK);
+			CHECK(BTEvaluateExpression::get_expression_cache_size() == cache_size + 1);
+			other->set_expression_string("callback()");
+			CHECK(other->parse() == OK); // * Shares the entry of the task under test.
+			CHECK(BTEvaluateExpression::get_expression_cache_size() == cache_size);
+			other.unref();
+			CHECK(BTEvaluateExpression::get_expression_cache_size() == cache_size);
+			ee->set_expression_string("callback() + 2");
+			CHECK(ee->parse() == OK);
+			CHECK(BTEvaluateExpression::get_expression_cache_size() == cache_size);
+		}
+				SUBCASE("When expression string is empty") {
 			ee->set_expression_string("");
 			CHECK(ee->parse() == ERR_INVALID_PARAMETER);
 			ERR_PRINT_OFF;
@@ -206,6 +221,26 @@ TEST_CASE("[Modules][LimboAI] BTEvaluateExpression") {
 			}
 		}
 
+		SUBCASE("Saved input values changed after the first tick are used") {
+			ee->set_expression_string("value * 2");
+			ee->set_result_var("result");
+			PackedStringArray input_names;
+			input_names.push_back("value");
+			ee->set_input_names(input_names);
+			CHECK(ee->parse() == OK);
+			Ref<BBVariant> value_param = memnew(BBVariant(1));
+			TypedArray<BBVariant> input_values;
+			input_values.push_back(value_param);
+			ee->set_input_values(input_values);
+
+			CHECK(ee->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(int(bb->get_var("result", 0)) == 2);
+
+			value_param->set_saved_value(5);
+			CHECK(ee->execute(0.01666) == BTTask::SUCCESS);
+			CHECK(int(bb->get_var("result", 0)) == 10);
+		}
+
 		memdelete(dummy);
 	}
 }
@@ -112,6 +112,65 @@ TEST_CASE("[Modules][LimboAI] BTForEach") {
 		CHECK_ENTRIES_TICKS_EXITS(task, 1, 1, 1); // Task is not re-executed as there is not enough elements to continue iteration.
 		CHECK(blackboard->get_var("element", "wetgoop") == "apple"); // Not changed.
 	}
+
+	SUBCASE("With a snapshot of the array") {
+		fe->set_iteration_mode(BTForEach::ITERATION_SNAPSHOT);
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(blackboard->get_var("element", "wetgoop") == "apple");
+
+		arr.clear();
+		blackboard->set_var("array", Array());
+
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(blackboard->get_var("element", "wetgoop") == "raspberry");
+		CHECK(fe->execute(0.01666) == BTTask::SUCCESS);
+		CHECK(blackboard->get_var("element", "wetgoop") == "mushroom");
+		CHECK_ENTRIES_TICKS_EXITS(task, 3, 3, 3);
+	}
+
+	SUBCASE("With a packed array") {
+		PackedVector3Array points;
+		points.push_back(Vector3(1, 0, 0));
+		points.push_back(Vector3(0, 2, 0));
+		blackboard->set_var("array", points);
+
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(Vector3(1, 0, 0)));
+		CHECK(fe->execute(0.01666) == BTTask::SUCCESS);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(Vector3(0, 2, 0)));
+	}
+
+	SUBCASE("With a range") {
+		blackboard->set_var("array", Vector3i(10, 4, -3));
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(10));
+		CHECK(fe->execute(0.01666) == BTTask::SUCCESS);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(7));
+		CHECK_ENTRIES_TICKS_EXITS(task, 2, 2, 2);
+
+		blackboard->set_var("array", 3);
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(0));
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(fe->execute(0.01666) == BTTask::SUCCESS);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(2));
+
+		blackboard->set_var("array", Vector3i(-2147483647 - 1, 2147483647, 1073741824));
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(-2147483648LL));
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(fe->execute(0.01666) == BTTask::RUNNING);
+		CHECK(fe->execute(0.01666) == BTTask::SUCCESS);
+		CHECK(blackboard->get_var("element", Variant()) == Variant(1073741824LL));
+	}
+
+	SUBCASE("With a zero range step") {
+		blackboard->set_var("array", Vector3i(0, 4, 0));
+		ERR_PRINT_OFF;
+		CHECK(fe->execute(0.01666) == BTTask::FAILURE);
+		ERR_PRINT_ON;
+		CHECK_ENTRIES_TICKS_EXITS(task, 0, 0, 0);
+	}
 }
 
 } //namespace TestForEach
@@ -0,0 +1,92 @@
+/**
+ * test_instance_pool.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef TEST_INSTANCE_POOL_H
+#define TEST_INSTANCE_POOL_H
+
+#include "limbo_test.h"
+
+#include "modules/limboai/bt/behavior_tree.h"
+#include "modules/limboai/bt/bt_instance_pool.h"
+#include "modules/limboai/bt/tasks/composites/bt_sequence.h"
+
+namespace TestInstancePool {
+
+TEST_CASE("[Modules][LimboAI] BTInstancePool") {
+	ClassDB::register_class<BTTestAction>();
+
+	Ref<BehaviorTree> bt = memnew(BehaviorTree);
+	Ref<BTSequence> seq = memnew(BTSequence);
+	Ref<BTTestAction> action = memnew(BTTestAction(BTTask::RUNNING));
+	seq->add_child(action);
+	bt->set_root_task(seq);
+
+	Ref<BTInstancePool> pool = memnew(BTInstancePool);
+	pool->set_behavior_tree(bt);
+
+	Node *agent1 = memnew(Node);
+	Node *agent2 = memnew(Node);
+	Ref<Blackboard> bb1 = memnew(Blackboard);
+	Ref<Blackboard> bb2 = memnew(Blackboard);
+
+	SUBCASE("Prewarm") {
+		pool->prewarm(3);
+		CHECK(pool->get_available_count() == 3);
+		Ref<BTInstance> inst = pool->acquire(agent1, bb1, agent1, agent1);
+		REQUIRE(inst.is_valid());
+		CHECK(inst->get_agent() == agent1);
+		CHECK(inst->get_blackboard() == bb1);
+		CHECK(inst->get_root_task() != seq);
+		CHECK(pool->get_available_count() == 2);
+	}
+
+	SUBCASE("Release and acquire resets the instance in place") {
+		Ref<BTInstance> inst = pool->acquire(agent1, bb1, agent1, agent1);
+		REQUIRE(inst.is_valid());
+		Ref<BTTask> root = inst->get_root_task();
+		Ref<BTTestAction> child = root->get_child(0);
+
+		CHECK(inst->update(0.1) == BTTask::RUNNING);
+		CHECK_STATUS_ENTRIES_TICKS_EXITS(child, BTTask::RUNNING, 1, 1, 0);
+
+		pool->release(inst);
+		CHECK(pool->get_available_count() == 1);
+		CHECK_STATUS_ENTRIES_TICKS_EXITS(child, BTTask::FRESH, 1, 1, 1); // * Aborted on release.
+
+		Ref<BTInstance> recycled = pool->acquire(agent2, bb2, agent2, agent2);
+		CHECK(recycled == inst);
+		CHECK(recycled->get_root_task() == root);
+		CHECK(recycled->get_agent() == agent2);
+		CHECK(child->get_blackboard() == bb2);
+		CHECK(recycled->get_last_status() == BTTask::FRESH);
+		CHECK(pool->get_available_count() == 0);
+	}
+
+	SUBCASE("Release rejects instances of another BehaviorTree") {
+		Ref<BehaviorTree> other_bt = memnew(BehaviorTree);
+		other_bt->set_root_task(memnew(BTSequence));
+		Ref<BTInstance> inst = other_bt->instantiate(agent1, bb1, agent1, agent1);
+		REQUIRE(inst.is_valid());
+		CHECK(inst->get_source_bt_path() == bt->get_path()); // * Both trees have no path.
+
+		ERR_PRINT_OFF;
+		pool->release(inst);
+		ERR_PRINT_ON;
+		CHECK(pool->get_available_count() == 0);
+	}
+
+	memdelete(agent1);
+	memdelete(agent2);
+}
+
+} //namespace TestInstancePool
+
+#endif // TEST_INSTANCE_POOL_H
@@ -0,0 +1,147 @@
+/**
+ * test_instance_state.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef TEST_INSTANCE_STATE_H
+#define TEST_INSTANCE_STATE_H
+
+#include "limbo_test.h"
+
+#include "modules/limboai/bt/behavior_tree.h"
+#include "modules/limboai/bt/bt_instance.h"
+#include "modules/limboai/bt/tasks/composites/bt_selector.h"
+#include "modules/limboai/bt/tasks/composites/bt_sequence.h"
+#include "modules/limboai/bt/tasks/decorators/bt_new_scope.h"
+#include "modules/limboai/bt/tasks/decorators/bt_repeat.h"
+
+namespace TestInstanceState {
+
+TEST_CASE("[Modules][LimboAI] BTInstance state") {
+	ClassDB::register_class<BTTestAction>();
+
+	Ref<BehaviorTree> bt = memnew(BehaviorTree);
+	Ref<BTSequence> seq = memnew(BTSequence);
+	Ref<BTRepeat> rep = memnew(BTRepeat);
+	rep->set_times(3);
+	rep->add_child(memnew(BTTestAction(BTTask::SUCCESS)));
+	seq->add_child(rep);
+	seq->add_child(memnew(BTTestAction(BTTask::RUNNING)));
+	bt->set_root_task(seq);
+
+	Node *agent = memnew(Node);
+	Ref<Blackboard> bb = memnew(Blackboard);
+	bb->set_var("hp", 10);
+
+	Ref<BTInstance> inst = bt->instantiate(agent, bb, agent, agent);
+	REQUIRE(inst.is_valid());
+
+	SUBCASE("Save and load resumes the tree") {
+		CHECK(inst->update(0.1) == BTTask::RUNNING); // * Repeat: 1st iteration.
+		PackedByteArray state = inst->save_state();
+		CHECK_FALSE(state.is_empty());
+
+		Ref<Blackboard> other_bb = memnew(Blackboard);
+		Ref<BTInstance> other = bt->instantiate(agent, other_bb, agent, agent);
+		other->load_state(state);
+		CHECK(other->get_last_status() == BTTask::RUNNING);
+		CHECK(other->get_root_task()->get_status() == BTTask::RUNNING);
+		CHECK(other->get_root_task()->get_child(0)->get_status() == BTTask::RUNNING);
+		CHECK(other->get_root_task()->get_elapsed_time() == doctest::Approx(0.1));
+		CHECK_EQ(other_bb->get_var("hp", Variant()), Variant(10));
+
+		// * Repeat resumes from the 2nd iteration, and the running child is not entered again.
+		Ref<BTTestAction> repeated = other->get_root_task()->get_child(0)->get_child(0);
+		CHECK(other->update(0.1) == BTTask::RUNNING);
+		CHECK(repeated->num_entries == 1);
+		CHECK(other->update(0.1) == BTTask::RUNNING);
+		CHECK(repeated->num_entries == 2);
+		CHECK(other->get_root_task()->get_child(0)->get_status() == BTTask::SUCCESS);
+	}
+
+	SUBCASE("Scope blackboards are restored") {
+		Ref<BehaviorTree> scoped_bt = memnew(BehaviorTree);
+		Ref<BTSequence> scoped_seq = memnew(BTSequence);
+		Ref<BTNewScope> scope = memnew(BTNewScope);
+		scope->add_child(memnew(BTTestAction(BTTask::RUNNING)));
+		scoped_seq->add_child(scope);
+		scoped_bt->set_root_task(scoped_seq);
+
+		Ref<BTInstance> scoped = scoped_bt->instantiate(agent, memnew(Blackboard), agent, agent);
+		REQUIRE(scoped.is_valid());
+		CHECK(scoped->update(0.1) == BTTask::RUNNING);
+		Ref<Blackboard> scope_bb = scoped->get_root_task()->get_child(0)->get_blackboard();
+		REQUIRE(scope_bb != scoped->get_blackboard());
+		scope_bb->set_var("local", 5);
+
+		Ref<BTInstance> other = scoped_bt->instantiate(agent, memnew(Blackboard), agent, agent);
+		other->load_state(scoped->save_state());
+		Ref<Blackboard> other_scope_bb = other->get_root_task()->get_child(0)->get_blackboard();
+		CHECK_EQ(other_scope_bb->get_var("local", Variant()), Variant(5));
+		CHECK_FALSE(other->get_blackboard()->has_var("local"));
+	}
+
+	SUBCASE("State of a different tree is rejected") {
+		Ref<BehaviorTree> other_bt = memnew(BehaviorTree);
+		other_bt->set_root_task(memnew(BTTestAction(BTTask::RUNNING)));
+		Ref<BTInstance> other = other_bt->instantiate(agent, memnew(Blackboard), agent, agent);
+
+		ERR_PRINT_OFF;
+		other->load_state(inst->save_state());
+		ERR_PRINT_ON;
+		CHECK(other->get_last_status() == BTTask::FRESH);
+	}
+
+	SUBCASE("State of a tree with different tasks is rejected") {
+		Ref<BehaviorTree> other_bt = memnew(BehaviorTree);
+		Ref<BTSelector> sel = memnew(BTSelector);
+		Ref<BTRepeat> other_rep = memnew(BTRepeat);
+		other_rep->add_child(memnew(BTTestAction(BTTask::SUCCESS)));
+		sel->add_child(other_rep);
+		sel->add_child(memnew(BTTestAction(BTTask::RUNNING)));
+		other_bt->set_root_task(sel);
+		Ref<BTInstance> other = other_bt->instantiate(agent, memnew(Blackboard), agent, agent);
+
+		CHECK(inst->update(0.1) == BTTask::RUNNING);
+		ERR_PRINT_OFF;
+		other->load_state(inst->save_state());
+		ERR_PRINT_ON;
+		CHECK(other->get_last_status() == BTTask::FRESH);
+		CHECK(other->get_root_task()->get_status() == BTTask::FRESH);
+	}
+
+	SUBCASE("Corrupted state leaves the instance untouched") {
+		CHECK(inst->update(0.1) == BTTask::RUNNING);
+		PackedByteArray state = inst->save_state();
+
+		Ref<Blackboard> other_bb = memnew(Blackboard);
+		other_bb->set_var("hp", 20);
+		Ref<BTInstance> other = bt->instantiate(agent, other_bb, agent, agent);
+		CHECK(other->update(0.5) == BTTask::RUNNING);
+
+		PackedByteArray truncated = state.slice(0, state.size() - 4);
+		PackedByteArray bad_status = state;
+		bad_status.set(9, 7); // * Last status, out of range.
+
+		ERR_PRINT_OFF;
+		other->load_state(truncated);
+		other->load_state(bad_status);
+		ERR_PRINT_ON;
+		CHECK(other->get_last_status() == BTTask::RUNNING);
+		CHECK(other->get_root_task()->get_status() == BTTask::RUNNING);
+		CHECK(other->get_root_task()->get_elapsed_time() == doctest::Approx(0.5));
+		CHECK_EQ(other_bb->get_var("hp", Variant()), Variant(20));
+	}
+
+	memdelete(agent);
+}
+
+} //namespace TestInstanceState
+
+#endif // TEST_INSTANCE_STATE_H
@@ -0,0 +1,84 @@
+/**
+ * test_instance_thread_safety.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef TEST_INSTANCE_THREAD_SAFETY_H
+#define TEST_INSTANCE_THREAD_SAFETY_H
+
+#include "limbo_test.h"
+
+#include "modules/limboai/blackboard/bb_param/bb_variant.h"
+#include "modules/limboai/bt/behavior_tree.h"
+#include "modules/limboai/bt/bt_instance.h"
+#include "modules/limboai/bt/tasks/blackboard/bt_set_var.h"
+#include "modules/limboai/bt/tasks/composites/bt_sequence.h"
+#include "modules/limboai/bt/tasks/utility/bt_wait.h"
+
+namespace TestInstanceThreadSafety {
+
+TEST_CASE("[Modules][LimboAI] BTInstance thread safety") {
+	Ref<BehaviorTree> bt = memnew(BehaviorTree);
+	Ref<BTSequence> seq = memnew(BTSequence);
+	Ref<BTSetVar> set_var = memnew(BTSetVar);
+	Ref<BBVariant> value = memnew(BBVariant);
+	value->set_type(Variant::INT);
+	value->set_saved_value(1);
+	set_var->set_variable("hp");
+	set_var->set_value(value);
+	seq->add_child(set_var);
+	seq->add_child(memnew(BTWait));
+	bt->set_root_task(seq);
+
+	Node *agent = memnew(Node);
+	Ref<Blackboard> bb = memnew(Blackboard);
+	bb->set_var("hp", 10);
+
+	Ref<BTInstance> inst = bt->instantiate(agent, bb, agent, agent);
+	REQUIRE(inst.is_valid());
+	CHECK(inst->is_thread_safe());
+
+	SUBCASE("Binding a variable makes the tree unsafe") {
+		bb->bind_var_to_property("hp", agent, "name");
+		CHECK_FALSE(inst->is_thread_safe());
+		bb->unbind_var("hp");
+		CHECK(inst->is_thread_safe());
+	}
+
+	SUBCASE("Sharing the blackboard through a parent scope makes the tree unsafe") {
+		Ref<Blackboard> parent_bb = memnew(Blackboard);
+		bb->set_parent(parent_bb);
+		CHECK_FALSE(inst->is_thread_safe());
+		bb->set_parent(Ref<Blackboard>());
+		CHECK(inst->is_thread_safe());
+	}
+
+	SUBCASE("Linking a variable to another blackboard makes the tree unsafe") {
+		Ref<Blackboard> other_bb = memnew(Blackboard);
+		other_bb->set_var("shared_hp", 5);
+		bb->link_var("hp", other_bb, "shared_hp");
+		CHECK_FALSE(inst->is_thread_safe());
+	}
+
+	SUBCASE("Node path parameters make the tree unsafe") {
+		Ref<BTSetVar> set_path = memnew(BTSetVar);
+		Ref<BBVariant> path_param = memnew(BBVariant);
+		path_param->set_type(Variant::NODE_PATH);
+		set_path->set_variable("target");
+		set_path->set_value(path_param);
+		inst->get_root_task()->add_child(set_path);
+		CHECK_FALSE(inst->is_thread_safe());
+	}
+
+	memdelete(agent);
+}
+
+} //namespace TestInstanceThreadSafety
+
+#endif // TEST_INSTANCE_THREAD_SAFETY_H
@@ -14,6 +14,7 @@
 
 #include "limbo_test.h"
 
+#include "modules/limboai/bt/bt_instance.h"
 #include "modules/limboai/bt/tasks/bt_task.h"
 #include "modules/limboai/bt/tasks/decorators/bt_new_scope.h"
 
@@ -92,6 +93,20 @@ TEST_CASE("[Modules][LimboAI] BTNewScope") {
 		CHECK(ns->execute(0.01666) == BTTask::RUNNING);
 	}
 
+	SUBCASE("Changes in the scope are dispatched by the instance") {
+		Ref<BTTestAction> child = memnew(BTTestAction(BTTask::RUNNING));
+		ns->add_child(child);
+		Ref<BTInstance> inst = BTInstance::create(ns, "", dummy);
+		ns->initialize(dummy, parent_bb, dummy);
+
+		Ref<CallbackCounter> counter = memnew(CallbackCounter);
+		Callable callback = callable_mp(counter.ptr(), &CallbackCounter::callback).unbind(2);
+		ns->get_blackboard()->subscribe_var("berry", callback);
+		ns->get_blackboard()->set_var("berry", "raspberry");
+		CHECK(inst->update(0.01666) == BTTask::RUNNING);
+		CHECK_EQ(counter->num_callbacks, 1);
+	}
+
 	memdelete(dummy);
 }
 
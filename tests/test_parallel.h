@@ -14,8 +14,15 @@
 
 #include "limbo_test.h"
 
+#include "modules/limboai/blackboard/bb_param/bb_variant.h"
+#include "modules/limboai/bt/tasks/blackboard/bt_check_var.h"
+#include "modules/limboai/bt/tasks/blackboard/bt_set_var.h"
 #include "modules/limboai/bt/tasks/bt_task.h"
 #include "modules/limboai/bt/tasks/composites/bt_parallel.h"
+#include "modules/limboai/bt/tasks/utility/bt_wait.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 
 namespace TestParallel {
 
@@ -207,6 +214,132 @@ TEST_CASE("[Modules][LimboAI] BTParallel with num_required_successes: 1 and num_
 	}
 }
 
+TEST_CASE("[Modules][LimboAI] BTParallel with a sleeping child") {
+	Ref<BTParallel> par = memnew(BTParallel);
+	Ref<BTWait> wait = memnew(BTWait);
+	Ref<BTTestAction> task = memnew(BTTestAction(BTTask::RUNNING));
+	wait->set_duration(1.0);
+	par->add_child(wait);
+	par->add_child(task);
+
+	CHECK(par->execute(0.5) == BTTask::RUNNING);
+	CHECK(wait->get_status() == BTTask::RUNNING);
+	CHECK_ENTRIES_TICKS_EXITS(task, 1, 1, 0);
+
+	// * Sleeping child is skipped, while others are still executed.
+	CHECK(par->execute(0.5) == BTTask::RUNNING);
+	CHECK(wait->get_elapsed_time() == doctest::Approx(0.0));
+	CHECK_ENTRIES_TICKS_EXITS(task, 1, 2, 0);
+
+	// * Delta accumulated while sleeping is passed to the child on wake.
+	CHECK(par->execute(0.5) == BTTask::SUCCESS);
+	CHECK(wait->get_status() == BTTask::SUCCESS);
+	CHECK_ENTRIES_TICKS_EXITS(task, 1, 3, 0);
+}
+
+// Provides a property for blackboard bindings, and records if it was read outside the main thread.
+class ThreadCheckedObject : public Object {
+	GDCLASS(ThreadCheckedObject, Object);
+
+public:
+	mutable bool read_off_main_thread = false;
+
+protected:
+	bool _get(const StringName &p_name, Variant &r_ret) const {
+		if (p_name != StringName("hp")) {
+			return false;
+		}
+		read_off_main_thread = read_off_main_thread || Thread::get_caller_id() != Thread::get_main_id();
+		r_ret = 10;
+		return true;
+	}
+};
+
+static Ref<BTCheckVar> _make_check_var(const StringName &p_variable, LimboUtility::CheckType p_check_type, const Variant &p_value) {
+	Ref<BTCheckVar> cv = memnew(BTCheckVar);
+	Ref<BBVariant> value = memnew(BBVariant);
+	value->set_type(p_value.get_type());
+	value->set_saved_value(p_value);
+	cv->set_variable(p_variable);
+	cv->set_check_type(p_check_type);
+	cv->set_value(value);
+	return cv;
+}
+
+TEST_CASE("[Modules][LimboAI] BTParallel with run_threaded") {
+	Ref<BTParallel> par = memnew(BTParallel);
+	Ref<BTCheckVar> check_hp = _make_check_var("hp", LimboUtility::CHECK_GREATER_THAN, 0);
+	Ref<BTCheckVar> check_ammo = _make_check_var("ammo", LimboUtility::CHECK_GREATER_THAN_OR_EQUAL, 1);
+	Ref<BTWait> wait = memnew(BTWait);
+	wait->set_duration(1.0);
+	par->add_child(check_hp);
+	par->add_child(check_ammo);
+	par->add_child(wait);
+	par->set_num_successes_required(3);
+	par->set_num_failures_required(2);
+	par->set_repeat(true);
+	par->set_run_threaded(true);
+
+	Ref<Blackboard> bb = memnew(Blackboard);
+	bb->set_var("hp", 10);
+	bb->set_var("ammo", 0);
+	Node *agent = memnew(Node);
+	par->initialize(agent, bb, agent);
+
+	SUBCASE("Read-only children are executed concurrently") {
+		CHECK(par->get_configuration_warnings().is_empty());
+
+		CHECK(par->execute(0.5) == BTTask::RUNNING);
+		CHECK(check_hp->get_status() == BTTask::SUCCESS);
+		CHECK(check_ammo->get_status() == BTTask::FAILURE);
+		CHECK(wait->get_status() == BTTask::RUNNING);
+
+		bb->set_var("ammo", 2);
+		CHECK(par->execute(0.5) == BTTask::RUNNING);
+		CHECK(check_ammo->get_status() == BTTask::SUCCESS);
+		CHECK(wait->get_status() == BTTask::RUNNING);
+
+		CHECK(par->execute(0.5) == BTTask::SUCCESS);
+		CHECK(wait->get_status() == BTTask::SUCCESS);
+	}
+
+	SUBCASE("Children are executed sequentially on a worker thread") {
+		bb->set_var("ammo", 2);
+		par->set_num_successes_required(2);
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_task(
+				callable_mp((BTTask *)par.ptr(), &BTTask::execute).bind(0.5), true, "BTParallel test");
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		CHECK(par->get_status() == BTTask::SUCCESS);
+		CHECK(check_hp->get_status() == BTTask::SUCCESS);
+		CHECK(check_ammo->get_status() == BTTask::SUCCESS);
+	}
+
+	SUBCASE("Bound variables disable threaded execution") {
+		ThreadCheckedObject *obj = memnew(ThreadCheckedObject);
+		bb->bind_var_to_property("hp", obj, "hp");
+		for (int i = 0; i < 3; i++) {
+			par->execute(0.5);
+		}
+		CHECK(check_hp->get_status() == BTTask::SUCCESS);
+		CHECK_FALSE(obj->read_off_main_thread);
+		bb->unbind_var("hp");
+		memdelete(obj);
+	}
+
+	SUBCASE("Children that write to the blackboard disable threaded execution") {
+		Ref<BTSetVar> set_var = memnew(BTSetVar);
+		Ref<BBVariant> value = memnew(BBVariant);
+		value->set_type(Variant::INT);
+		value->set_saved_value(1);
+		set_var->set_variable("ammo");
+		set_var->set_value(value);
+		par->add_child(set_var);
+		CHECK_FALSE(par->get_configuration_warnings().is_empty());
+	}
+
+	memdelete(agent);
+}
+
 } //namespace TestParallel
 
 #endif // TEST_PARALLEL_H
@@ -0,0 +1,420 @@
+/**
+ * test_scheduler.h
+ * =============================================================================
+ * Copyright (c) 2023-present Serhii Snitsaruk and the LimboAI contributors.
+ *
+ * Use of this source code is governed by an MIT-style
+ * license that can be found in the LICENSE file or at
+ * https://opensource.org/licenses/MIT.
+ * =============================================================================
+ */
+
+#ifndef TEST_SCHEDULER_H
+#define TEST_SCHEDULER_H
+
+#include "limbo_test.h"
+
+#include "modules/limboai/bt/behavior_tree.h"
+#include "modules/limboai/bt/bt_player.h"
+#include "modules/limboai/bt/bt_scheduler.h"
+#include "modules/limboai/bt/tasks/composites/bt_dynamic_sequence.h"
+#include "modules/limboai/bt/tasks/decorators/bt_cooldown.h"
+#include "modules/limboai/bt/tasks/utility/bt_wait_ticks.h"
+#include "modules/limboai/hsm/limbo_hsm.h"
+#include "modules/limboai/hsm/limbo_state.h"
+
+#include "core/config/engine.h"
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+namespace TestScheduler {
+
+class SchedulerTestClient : public RefCounted {
+	GDCLASS(SchedulerTestClient, RefCounted);
+
+public:
+	int num_updates = 0;
+	double total_delta = 0.0;
+	uint64_t delay_usec = 0; // Makes each update slow, for time budget tests.
+	BTPlayer *deactivate_on_update = nullptr;
+
+	void on_player_updated(int p_status) { _on_updated(0.0); }
+	void on_state_updated(double p_delta) { _on_updated(p_delta); }
+
+private:
+	void _on_updated(double p_delta) {
+		num_updates += 1;
+		total_delta += p_delta;
+		if (delay_usec > 0) {
+			OS::get_singleton()->delay_usec(delay_usec);
+		}
+		if (deactivate_on_update) {
+			deactivate_on_update->set_active(false);
+		}
+	}
+};
+
+class TimeoutRecorder : public RefCounted {
+	GDCLASS(TimeoutRecorder, RefCounted);
+
+public:
+	static inline LocalVector<int> fired; // IDs of recorders in the order their timeouts fired.
+	int id = 0;
+
+	static void callback(Object *p_object) { fired.push_back(Object::cast_to<TimeoutRecorder>(p_object)->id); }
+
+	TimeoutRecorder(int p_id = 0) { id = p_id; }
+};
+
+// Tree that keeps running; p_num_instant_tasks tasks that succeed right away are evaluated on each tick before it.
+inline Ref<BehaviorTree> make_tree(int p_num_instant_tasks = 0) {
+	Ref<BTDynamicSequence> seq = memnew(BTDynamicSequence);
+	for (int i = 0; i < p_num_instant_tasks; i++) {
+		Ref<BTWaitTicks> instant = memnew(BTWaitTicks);
+		instant->set_num_ticks(0);
+		seq->add_child(instant);
+	}
+	Ref<BTWaitTicks> wait = memnew(BTWaitTicks);
+	wait->set_num_ticks(1000000);
+	seq->add_child(wait);
+
+	Ref<BehaviorTree> bt = memnew(BehaviorTree);
+	bt->set_root_task(seq);
+	return bt;
+}
+
+inline BTPlayer *make_player(Node *p_agent, const Ref<SchedulerTestClient> &p_client, const Ref<BehaviorTree> &p_tree = make_tree()) {
+	BTPlayer *player = memnew(BTPlayer);
+	player->set_behavior_tree(p_tree);
+	player->set_update_mode(BTPlayer::UpdateMode::IDLE);
+	player->set_scene_root_hint(p_agent);
+	player->connect("updated", callable_mp(p_client.ptr(), &SchedulerTestClient::on_player_updated));
+	p_agent->add_child(player);
+	return player;
+}
+
+inline LimboHSM *make_hsm(Node *p_agent, const Ref<SchedulerTestClient> &p_client) {
+	LimboHSM *hsm = memnew(LimboHSM);
+	LimboState *state = memnew(LimboState);
+	hsm->add_child(state);
+	hsm->set_initial_state(state);
+	hsm->set_update_mode(LimboHSM::UpdateMode::IDLE);
+	hsm->call_on_update(callable_mp(p_client.ptr(), &SchedulerTestClient::on_state_updated));
+	p_agent->add_child(hsm);
+	hsm->initialize(p_agent);
+	hsm->set_active(true);
+	return hsm;
+}
+
+TEST_CASE("[SceneTree][LimboAI] BTScheduler") {
+	BTScheduler *scheduler = BTScheduler::get_singleton();
+	REQUIRE(scheduler != nullptr);
+	REQUIRE(scheduler->get_client_count() == 0);
+	scheduler->set_enabled_for_tests(true);
+
+	Node *agent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(agent);
+
+	SUBCASE("Players and state machines are registered") {
+		Ref<SchedulerTestClient> player_client = memnew(SchedulerTestClient);
+		Ref<SchedulerTestClient> hsm_client = memnew(SchedulerTestClient);
+		BTPlayer *player = make_player(agent, player_client);
+		LimboHSM *hsm = make_hsm(agent, hsm_client);
+		REQUIRE(player->get_bt_instance().is_valid());
+		CHECK(scheduler->get_client_count() == 2);
+
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(player_client->num_updates == 1);
+		CHECK(hsm_client->num_updates == 1);
+		CHECK(hsm_client->total_delta == doctest::Approx(0.1));
+
+		// * Physics clients are not updated on idle frames.
+		hsm->set_update_mode(LimboHSM::UpdateMode::PHYSICS);
+		CHECK(scheduler->get_client_count() == 2);
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(player_client->num_updates == 2);
+		CHECK(hsm_client->num_updates == 1);
+		scheduler->physics_frame_for_tests(0.1);
+		CHECK(hsm_client->num_updates == 2);
+
+		player->set_active(false);
+		CHECK(scheduler->get_client_count() == 1);
+		hsm->set_update_mode(LimboHSM::UpdateMode::MANUAL);
+		CHECK(scheduler->get_client_count() == 0);
+		scheduler->process_frame_for_tests(0.1);
+		scheduler->physics_frame_for_tests(0.1);
+		CHECK(player_client->num_updates == 2);
+		CHECK(hsm_client->num_updates == 2);
+
+		player->set_active(true);
+		CHECK(scheduler->get_client_count() == 1);
+		agent->remove_child(player);
+		CHECK(scheduler->get_client_count() == 0);
+		memdelete(player);
+	}
+
+	SUBCASE("Client removed during a tick is not updated") {
+		Ref<SchedulerTestClient> client1 = memnew(SchedulerTestClient);
+		Ref<SchedulerTestClient> client2 = memnew(SchedulerTestClient);
+		make_player(agent, client1);
+		BTPlayer *player2 = make_player(agent, client2);
+		client1->deactivate_on_update = player2;
+
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(client1->num_updates == 1);
+		CHECK(client2->num_updates == 0);
+		CHECK(scheduler->get_client_count() == 1);
+
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(client1->num_updates == 2);
+		CHECK(client2->num_updates == 0);
+	}
+
+	SUBCASE("State machines in the editor are not registered") {
+		Ref<SchedulerTestClient> client = memnew(SchedulerTestClient);
+		Engine::get_singleton()->set_editor_hint(true);
+		LimboHSM *hsm = make_hsm(agent, client);
+		Engine::get_singleton()->set_editor_hint(false);
+		CHECK(hsm->is_active());
+		CHECK(scheduler->get_client_count() == 0);
+
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(client->num_updates == 0);
+	}
+
+	SUBCASE("Time budget carries the round-robin over to the next frame") {
+		// * A budget of 1 usec lets one client update per frame, as each update takes longer.
+		scheduler->set_time_budget_usec(1);
+		Ref<SchedulerTestClient> clients[3];
+		for (int i = 0; i < 3; i++) {
+			clients[i] = memnew(SchedulerTestClient);
+			clients[i]->delay_usec = 20;
+			make_hsm(agent, clients[i]);
+		}
+
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(clients[0]->num_updates == 1);
+		CHECK(clients[1]->num_updates == 0);
+		CHECK(clients[2]->num_updates == 0);
+
+		scheduler->process_frame_for_tests(0.1);
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(clients[0]->num_updates == 1);
+		CHECK(clients[1]->num_updates == 1);
+		CHECK(clients[2]->num_updates == 1);
+
+		// * Skipped clients receive the time accumulated since their last update.
+		CHECK(clients[0]->total_delta == doctest::Approx(0.1));
+		CHECK(clients[1]->total_delta == doctest::Approx(0.2));
+		CHECK(clients[2]->total_delta == doctest::Approx(0.3));
+
+		scheduler->process_frame_for_tests(0.1);
+		CHECK(clients[0]->num_updates == 2);
+		CHECK(clients[0]->total_delta == doctest::Approx(0.4));
+	}
+
+	SUBCASE("Main thread clients are updated when worker threads use up the budget") {
+		scheduler->set_time_budget_usec(1);
+		scheduler->set_use_worker_threads(true);
+		// * The threaded tree evaluates enough tasks on each tick to use up the budget by itself.
+		Ref<SchedulerTestClient> player_client = memnew(SchedulerTestClient);
+		BTPlayer *player = make_player(agent, player_client, make_tree(2000));
+		REQUIRE(player->get_bt_instance()->is_thread_safe());
+		Ref<SchedulerTestClient> hsm_client = memnew(SchedulerTestClient);
+		make_hsm(agent, hsm_client);
+
+		for (int i = 0; i < 3; i++) {
+			scheduler->process_frame_for_tests(0.1);
+		}
+		CHECK(hsm_client->num_updates == 3);
+		CHECK(hsm_client->total_delta == doctest::Approx(0.3));
+		CHECK(player_client->num_updates == 3);
+	}
+
+	SUBCASE("LOD") {
+		Node2D *reference = memnew(Node2D);
+		agent->add_child(reference);
+		TypedArray<Node> reference_nodes;
+		reference_nodes.push_back(reference);
+		scheduler->set_lod_reference_nodes(reference_nodes);
+		PackedFloat32Array distances;
+		distances.push_back(10.0);
+		distances.push_back(20.0);
+		distances.push_back(30.0);
+		scheduler->set_lod_distances(distances);
+		scheduler->set_lod_update_interval(0.0);
+		scheduler->set_lod_policy(BTScheduler::LOD_POLICY_DISTANCE);
+
+		Node2D *agent_2d = memnew(Node2D);
+		agent_2d->set_position(Vector2(25.0, 0.0));
+		agent->add_child(agent_2d);
+		Ref<SchedulerTestClient> client = memnew(SchedulerTestClient);
+		LimboHSM *hsm = make_hsm(agent_2d, client);
+		hsm->set_lod_enabled(true);
+
+		SUBCASE("Level is evaluated from the distance to the nearest reference") {
+			scheduler->process_frame_for_tests(0.1);
+			CHECK(scheduler->get_client_lod_level(hsm) == 2);
+
+			agent_2d->set_position(Vector2(5.0, 0.0));
+			scheduler->process_frame_for_tests(0.1);
+			CHECK(scheduler->get_client_lod_level(hsm) == 0);
+
+			agent_2d->set_position(Vector2(0.0, 100.0));
+			scheduler->process_frame_for_tests(0.1);
+			CHECK(scheduler->get_client_lod_level(hsm) == BTScheduler::MAX_LOD_LEVEL);
+
+			Node2D *other_reference = memnew(Node2D);
+			other_reference->set_position(Vector2(0.0, 85.0));
+			agent->add_child(other_reference);
+			reference_nodes.push_back(other_reference);
+			scheduler->set_lod_reference_nodes(reference_nodes);
+			scheduler->process_frame_for_tests(0.1);
+			CHECK(scheduler->get_client_lod_level(hsm) == 1);
+		}
+
+		SUBCASE("Clients are updated once per 2^level frames with the accumulated delta") {
+			for (int i = 0; i < 3; i++) {
+				scheduler->process_frame_for_tests(0.1);
+			}
+			CHECK(client->num_updates == 0);
+			scheduler->process_frame_for_tests(0.1);
+			CHECK(client->num_updates == 1);
+			CHECK(client->total_delta == doctest::Approx(0.4));
+
+			for (int i = 0; i < 4; i++) {
+				scheduler->process_frame_for_tests(0.1);
+			}
+			CHECK(client->num_updates == 2);
+			CHECK(client->total_delta == doctest::Approx(0.8));
+		}
+
+		SUBCASE("Disabling LOD resets the level") {
+			scheduler->process_frame_for_tests(0.1);
+			REQUIRE(scheduler->get_client_lod_level(hsm) == 2);
+			hsm->set_lod_enabled(false);
+			CHECK(scheduler->get_client_lod_level(hsm) == 0);
+
+			// * Updated on the next frame with the delta accumulated so far, and is no longer evaluated.
+			scheduler->process_frame_for_tests(0.1);
+			CHECK(client->num_updates == 1);
+			CHECK(client->total_delta == doctest::Approx(0.2));
+			CHECK(scheduler->get_client_lod_level(hsm) == 0);
+		}
+	}
+
+	SUBCASE("Timeouts fire in the order of their time") {
+		TimeoutRecorder::fired.clear();
+		const double delays[] = { 0.5, 0.1, 0.3, 0.2, 0.4 };
+		Ref<TimeoutRecorder> recorders[5];
+		for (int i = 0; i < 5; i++) {
+			recorders[i] = memnew(TimeoutRecorder(i));
+			scheduler->add_timeout(recorders[i].ptr(), delays[i], false, &TimeoutRecorder::callback);
+		}
+
+		scheduler->process_frame_for_tests(0.25);
+		REQUIRE(TimeoutRecorder::fired.size() == 2);
+		CHECK(TimeoutRecorder::fired[0] == 1);
+		CHECK(TimeoutRecorder::fired[1] == 3);
+
+		scheduler->process_frame_for_tests(1.0);
+		REQUIRE(TimeoutRecorder::fired.size() == 5);
+		CHECK(TimeoutRecorder::fired[2] == 2);
+		CHECK(TimeoutRecorder::fired[3] == 4);
+		CHECK(TimeoutRecorder::fired[4] == 0);
+	}
+
+	SUBCASE("Timeouts of freed objects are skipped") {
+		TimeoutRecorder::fired.clear();
+		Ref<TimeoutRecorder> kept = memnew(TimeoutRecorder(1));
+		Ref<TimeoutRecorder> freed = memnew(TimeoutRecorder(2));
+		scheduler->add_timeout(freed.ptr(), 0.1, false, &TimeoutRecorder::callback);
+		scheduler->add_timeout(kept.ptr(), 0.2, false, &TimeoutRecorder::callback);
+		freed.unref();
+
+		scheduler->process_frame_for_tests(0.5);
+		REQUIRE(TimeoutRecorder::fired.size() == 1);
+		CHECK(TimeoutRecorder::fired[0] == 1);
+	}
+
+	SUBCASE("Clock stops while paused unless processing in pause") {
+		TimeoutRecorder::fired.clear();
+		Ref<TimeoutRecorder> recorder = memnew(TimeoutRecorder(1));
+		Ref<TimeoutRecorder> pause_recorder = memnew(TimeoutRecorder(2));
+		const double clock = scheduler->get_clock(false);
+		const double pause_clock = scheduler->get_clock(true);
+		scheduler->add_timeout(recorder.ptr(), 0.1, false, &TimeoutRecorder::callback);
+		scheduler->add_timeout(pause_recorder.ptr(), 0.1, true, &TimeoutRecorder::callback);
+
+		scheduler->process_frame_for_tests(0.2, true);
+		CHECK(scheduler->get_clock(false) == doctest::Approx(clock));
+		CHECK(scheduler->get_clock(true) == doctest::Approx(pause_clock + 0.2));
+		REQUIRE(TimeoutRecorder::fired.size() == 1);
+		CHECK(TimeoutRecorder::fired[0] == 2);
+
+		scheduler->process_frame_for_tests(0.2);
+		CHECK(scheduler->get_clock(false) == doctest::Approx(clock + 0.2));
+		REQUIRE(TimeoutRecorder::fired.size() == 2);
+		CHECK(TimeoutRecorder::fired[1] == 1);
+	}
+
+	SUBCASE("BTCooldown") {
+		Ref<BTCooldown> cooldown = memnew(BTCooldown);
+		cooldown->set_duration(1.0);
+		cooldown->set_cooldown_state_var("cooling");
+		Ref<BTWaitTicks> child = memnew(BTWaitTicks);
+		child->set_num_ticks(0);
+		cooldown->add_child(child);
+		Ref<BehaviorTree> bt = memnew(BehaviorTree);
+		bt->set_root_task(cooldown);
+
+		Ref<Blackboard> bb = memnew(Blackboard);
+		Ref<BTInstance> inst = bt->instantiate(agent, bb, agent, agent);
+		REQUIRE(inst.is_valid());
+		CHECK(inst->update(0.1) == BTTask::SUCCESS);
+		CHECK(bb->get_var("cooling", false));
+
+		SUBCASE("Timeout superseded by a new cooldown is ignored") {
+			scheduler->process_frame_for_tests(0.5);
+			// * Cooldown starts again before the first timeout fires.
+			bb->set_var("cooling", false);
+			CHECK(inst->update(0.1) == BTTask::SUCCESS);
+			scheduler->process_frame_for_tests(0.6);
+			CHECK(bb->get_var("cooling", false));
+			scheduler->process_frame_for_tests(0.5);
+			CHECK_FALSE(bb->get_var("cooling", true));
+		}
+
+		SUBCASE("Remaining time is saved and restored") {
+			scheduler->process_frame_for_tests(0.4);
+			PackedByteArray state = inst->save_state();
+
+			Ref<Blackboard> other_bb = memnew(Blackboard);
+			Ref<BTInstance> other = bt->instantiate(agent, other_bb, agent, agent);
+			CHECK_FALSE(other_bb->get_var("cooling", true));
+			other->load_state(state);
+			CHECK(other_bb->get_var("cooling", false));
+
+			scheduler->process_frame_for_tests(0.5);
+			CHECK(other_bb->get_var("cooling", false));
+			scheduler->process_frame_for_tests(0.2);
+			CHECK_FALSE(other_bb->get_var("cooling", true));
+		}
+	}
+
+	memdelete(agent);
+	CHECK(scheduler->get_client_count() == 0);
+	scheduler->set_lod_policy(BTScheduler::LOD_POLICY_NONE);
+	scheduler->set_lod_reference_nodes(TypedArray<Node>());
+	scheduler->set_lod_distances(PackedFloat32Array());
+	scheduler->set_lod_update_interval(0.25);
+	scheduler->set_time_budget_usec(0);
+	scheduler->set_use_worker_threads(false);
+	scheduler->set_enabled_for_tests(false);
+}
+
+} //namespace TestScheduler
+
+#endif // TEST_SCHEDULER_H
@@ -15,6 +15,8 @@
 #include "limbo_test.h"
 
 #include "modules/limboai/blackboard/blackboard.h"
+#include "modules/limboai/bt/bt_instance.h"
+#include "modules/limboai/bt/tasks/blackboard/bt_set_var.h"
 #include "modules/limboai/bt/tasks/bt_task.h"
 #include "tests/test_macros.h"
 
@@ -189,6 +191,40 @@ TEST_CASE("[Modules][LimboAI] BTTask") {
 			}
 			memdelete(dummy);
 		}
+		SUBCASE("Test BTInstance execution plan") {
+			Ref<BTTask> grandchild = memnew(BTTask);
+			child2->add_child(grandchild);
+
+			Node *dummy = memnew(Node);
+			Ref<Blackboard> bb = memnew(Blackboard);
+			task->initialize(dummy, bb, dummy);
+			Ref<BTInstance> inst = BTInstance::create(task, "", dummy);
+			REQUIRE(inst.is_valid());
+
+			const LocalVector<BTInstance::PlanEntry> &plan = inst->get_execution_plan();
+			REQUIRE(plan.size() == 5);
+			CHECK(plan[0].task == task);
+			CHECK(plan[0].parent == -1);
+			CHECK(plan[0].subtree_end == 5);
+			CHECK(plan[1].task == child1);
+			CHECK(plan[2].task == child2);
+			CHECK(plan[2].subtree_end == 4);
+			CHECK(plan[3].task == grandchild);
+			CHECK(plan[3].parent == 2);
+			CHECK(plan[4].task == child3);
+			CHECK(plan[4].parent == 0);
+
+			child3->add_child(memnew(BTTask));
+			CHECK(inst->get_execution_plan().size() == 6); // * Recompiled after the tree was changed.
+
+			Ref<BTTask> replacement = memnew(BTTask);
+			child2->remove_child(grandchild);
+			child2->add_child(replacement);
+			CHECK(inst->get_execution_plan().size() == 6);
+			CHECK(inst->get_execution_plan()[3].task == replacement); // * Recompiled when a child is replaced at the same index.
+
+			memdelete(dummy);
+		}
 	}
 
 	SUBCASE("Test get_elapsed_time()") {
@@ -233,6 +269,21 @@ TEST_CASE("[Modules][LimboAI] BTTask") {
 		CHECK_FALSE(cloned->get_child(0) == child1);
 		CHECK_FALSE(cloned->get_child(1) == child2);
 	}
+
+	SUBCASE("Test clone() with BBParam") {
+		Ref<BTSetVar> task = memnew(BTSetVar);
+		Ref<BBVariant> value = memnew(BBVariant);
+		task->set_value(value);
+
+		Ref<BTSetVar> cloned = task->clone();
+		CHECK_FALSE(cloned == task);
+		CHECK_FALSE(cloned->get_value() == value); // * Copied by default.
+
+		BTTask::set_share_bb_params(true);
+		cloned = task->clone();
+		CHECK(cloned->get_value() == value); // * Shared when opted in.
+		BTTask::set_share_bb_params(false);
+	}
 }
 
 } //namespace TestTask
@@ -14,7 +14,10 @@
 
 #include "limbo_test.h"
 
+#include "modules/limboai/bt/bt_instance.h"
 #include "modules/limboai/bt/tasks/bt_task.h"
+#include "modules/limboai/bt/tasks/composites/bt_dynamic_sequence.h"
+#include "modules/limboai/bt/tasks/composites/bt_sequence.h"
 #include "modules/limboai/bt/tasks/utility/bt_random_wait.h"
 #include "modules/limboai/bt/tasks/utility/bt_wait.h"
 #include "modules/limboai/bt/tasks/utility/bt_wait_ticks.h"
@@ -38,6 +41,60 @@ TEST_CASE("[Modules][LimboAI] BTWait") {
 	}
 }
 
+TEST_CASE("[Modules][LimboAI] BTWait puts BTInstance to sleep") {
+	Ref<BTWait> wait = memnew(BTWait);
+	wait->set_duration(1.0);
+	Ref<BTTestAction> action = memnew(BTTestAction(BTTask::SUCCESS));
+	Node *dummy = memnew(Node);
+	Ref<Blackboard> bb = memnew(Blackboard);
+
+	SUBCASE("Under a sequence") {
+		Ref<BTSequence> seq = memnew(BTSequence);
+		seq->add_child(wait);
+		seq->add_child(action);
+		seq->initialize(dummy, bb, dummy);
+		Ref<BTInstance> inst = BTInstance::create(seq, "", dummy);
+
+		CHECK(inst->update(0.0) == BTTask::RUNNING);
+		CHECK(inst->is_dormant());
+		CHECK(inst->update(0.5) == BTTask::RUNNING);
+		CHECK(inst->is_dormant());
+		CHECK(wait->get_elapsed_time() == doctest::Approx(0.0)); // * Not executed while dormant.
+
+		SUBCASE("Wakes when the time is up") {
+			CHECK(inst->update(0.5) == BTTask::SUCCESS); // * Accumulated delta is passed on wake.
+			CHECK_FALSE(inst->is_dormant());
+			CHECK(wait->get_status() == BTTask::SUCCESS);
+			CHECK_ENTRIES_TICKS_EXITS(action, 1, 1, 1);
+		}
+		SUBCASE("Wakes on request") {
+			inst->wake();
+			CHECK(inst->update(0.25) == BTTask::RUNNING);
+			CHECK(wait->get_elapsed_time() == doctest::Approx(0.75));
+			CHECK(inst->is_dormant()); // * Goes back to sleep for the remaining time.
+		}
+		SUBCASE("Wakes when aborted") {
+			seq->abort();
+			CHECK(inst->update(0.1) == BTTask::RUNNING);
+			CHECK(wait->get_elapsed_time() == doctest::Approx(0.0));
+		}
+	}
+	SUBCASE("Under a dynamic sequence") {
+		Ref<BTDynamicSequence> seq = memnew(BTDynamicSequence);
+		seq->add_child(action);
+		seq->add_child(wait);
+		seq->initialize(dummy, bb, dummy);
+		Ref<BTInstance> inst = BTInstance::create(seq, "", dummy);
+
+		CHECK(inst->update(0.0) == BTTask::RUNNING);
+		CHECK_FALSE(inst->is_dormant()); // * Dynamic sequence re-evaluates preceding children every tick.
+		CHECK(inst->update(0.5) == BTTask::RUNNING);
+		CHECK_ENTRIES_TICKS_EXITS(action, 2, 2, 2);
+	}
+
+	memdelete(dummy);
+}
+
 TEST_CASE("[Modules][LimboAI] BTWaitTicks") {
 	Ref<BTWaitTicks> wait = memnew(BTWaitTicks);
 
@@ -23,8 +23,10 @@ LimboStringNames *LimboStringNames::singleton = nullptr;
 
 LimboStringNames::LimboStringNames() {
 	_generate_name = SN("_generate_name");
+	_get = SN("_get");
 	_param_type = SN("_param_type");
 	_replace_task = SN("_replace_task");
+	_set = SN("_set");
 	_update_task_tree = SN("_update_task_tree");
 	_weight_ = SN("_weight_");
 	accent_color = SN("accent_color");
@@ -99,6 +101,7 @@ LimboStringNames::LimboStringNames() {
 	LimboVarPrivate = SN("LimboVarPrivate");
 	LineEdit = SN("LineEdit");
 	Load = SN("Load");
+	lod_enabled = SN("lod_enabled");
 	managed = SN("managed");
 	mode_changed = SN("mode_changed");
 	mouse_entered = SN("mouse_entered");
@@ -111,10 +114,12 @@ LimboStringNames::LimboStringNames() {
 	NonFavorite = SN("NonFavorite");
 	normal = SN("normal");
 	panel = SN("panel");
+	physics_frame = SN("physics_frame");
 	plan_changed = SN("plan_changed");
 	popup_hide = SN("popup_hide");
 	pressed = SN("pressed");
 	probability_clicked = SN("probability_clicked");
+	process_frame = SN("process_frame");
 	property_changed = SN("property_changed");
 	Reload = SN("Reload");
 	Remove = SN("Remove");
@@ -42,8 +42,10 @@ public:
 	_FORCE_INLINE_ static LimboStringNames *get_singleton() { return singleton; }
 
 	StringName _generate_name;
+	StringName _get;
 	StringName _param_type;
 	StringName _replace_task;
+	StringName _set;
 	StringName _update_task_tree;
 	StringName _weight_;
 	StringName accent_color;
@@ -118,6 +120,7 @@ public:
 	StringName LimboVarPrivate;
 	StringName LineEdit;
 	StringName Load;
+	StringName lod_enabled;
 	StringName managed;
 	StringName mode_changed;
 	StringName mouse_entered;
@@ -130,10 +133,12 @@ public:
 	StringName NonFavorite;
 	StringName normal;
 	StringName panel;
+	StringName physics_frame;
 	StringName plan_changed;
 	StringName popup_hide;
 	StringName pressed;
 	StringName probability_clicked;
+	StringName process_frame;
 	StringName property_changed;
 	StringName Reload;
 	StringName remove_child;
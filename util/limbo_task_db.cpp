@@ -25,6 +25,8 @@ using namespace godot;
 
 HashMap<String, List<String>> LimboTaskDB::core_tasks;
 HashMap<String, List<String>> LimboTaskDB::tasks_cache;
+HashSet<String> LimboTaskDB::thread_safe_tasks;
+HashSet<String> LimboTaskDB::pure_tasks;
 
 _FORCE_INLINE_ void _populate_scripted_tasks_from_dir(String p_path, List<String> *p_task_classes) {
 	if (p_path.is_empty()) {
@@ -87,6 +89,24 @@ _FORCE_INLINE_ void _populate_from_user_dir(String p_path, HashMap<String, List<
 	}
 }
 
+void LimboTaskDB::set_task_thread_safe(const String &p_class, bool p_thread_safe) {
+	if (p_thread_safe) {
+		thread_safe_tasks.insert(p_class);
+	} else {
+		thread_safe_tasks.erase(p_class);
+		pure_tasks.erase(p_class);
+	}
+}
+
+void LimboTaskDB::set_task_pure(const String &p_class, bool p_pure) {
+	if (p_pure) {
+		thread_safe_tasks.insert(p_class);
+		pure_tasks.insert(p_class);
+	} else {
+		pure_tasks.erase(p_class);
+	}
+}
+
 void LimboTaskDB::scan_user_tasks() {
 	tasks_cache = HashMap<String, List<String>>(core_tasks);
 
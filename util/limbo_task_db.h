@@ -15,12 +15,14 @@
 #ifdef LIMBOAI_MODULE
 #include "core/object/class_db.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/list.h"
 #endif // LIMBOAI_MODULE
 
 #ifdef LIMBOAI_GDEXTENSION
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/variant/string.hpp>
 using namespace godot;
@@ -30,6 +32,8 @@ class LimboTaskDB {
 private:
 	static HashMap<String, List<String>> core_tasks;
 	static HashMap<String, List<String>> tasks_cache;
+	static HashSet<String> thread_safe_tasks;
+	static HashSet<String> pure_tasks;
 
 	struct ComparatorByTaskName {
 		bool operator()(const String &p_left, const String &p_right) const {
@@ -39,8 +43,14 @@ private:
 
 public:
 	template <class T>
-	static void register_task() {
+	static void register_task(bool p_thread_safe = false, bool p_pure = false) {
 		GDREGISTER_CLASS(T);
+		if (p_thread_safe) {
+			thread_safe_tasks.insert(T::get_class_static());
+		}
+		if (p_pure) {
+			pure_tasks.insert(T::get_class_static());
+		}
 		HashMap<String, List<String>>::Iterator E = core_tasks.find(T::get_task_category());
 		if (E) {
 			E->value.push_back(T::get_class_static());
@@ -51,6 +61,16 @@ public:
 		}
 	}
 
+	// Thread-safe tasks only access the blackboard and their own state during execution,
+	// so trees composed of them can be executed on worker threads.
+	static void set_task_thread_safe(const String &p_class, bool p_thread_safe);
+	static _FORCE_INLINE_ bool is_task_thread_safe(const String &p_class) { return thread_safe_tasks.has(p_class); }
+
+	// Pure tasks are thread-safe tasks that never write to the blackboard, so they can also run
+	// concurrently with each other on a shared blackboard.
+	static void set_task_pure(const String &p_class, bool p_pure);
+	static _FORCE_INLINE_ bool is_task_pure(const String &p_class) { return pure_tasks.has(p_class); }
+
 	static void scan_user_tasks();
 	static _FORCE_INLINE_ String get_misc_category() { return "Misc"; }
 	static List<String> get_categories();
@@ -69,8 +89,18 @@ public:
 	if (m_class::_class_is_enabled) {            \
 		::LimboTaskDB::register_task<m_class>(); \
 	}
+#define LIMBO_REGISTER_THREAD_SAFE_TASK(m_class)     \
+	if (m_class::_class_is_enabled) {                \
+		::LimboTaskDB::register_task<m_class>(true); \
+	}
+#define LIMBO_REGISTER_PURE_TASK(m_class)                  \
+	if (m_class::_class_is_enabled) {                      \
+		::LimboTaskDB::register_task<m_class>(true, true); \
+	}
 #elif LIMBOAI_GDEXTENSION
 #define LIMBO_REGISTER_TASK(m_class) LimboTaskDB::register_task<m_class>();
+#define LIMBO_REGISTER_THREAD_SAFE_TASK(m_class) LimboTaskDB::register_task<m_class>(true);
+#define LIMBO_REGISTER_PURE_TASK(m_class) LimboTaskDB::register_task<m_class>(true, true);
 #endif
 
 #define TASK_CATEGORY(m_cat)                           \
@@ -24,6 +24,7 @@
 #include "core/input/input_event.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_node.h"
@@ -39,6 +40,150 @@
 
 LimboUtility *LimboUtility::singleton = nullptr;
 
+namespace {
+
+// * Native evaluators for numeric and boolean operands.
+
+struct OpAdd {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ auto apply(A a, B b) { return a + b; }
+};
+struct OpSubtract {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ auto apply(A a, B b) { return a - b; }
+};
+struct OpMultiply {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ auto apply(A a, B b) { return a * b; }
+};
+struct OpDivide {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ auto apply(A a, B b) { return a / b; }
+};
+struct OpEqual {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ bool apply(A a, B b) { return a == b; }
+};
+struct OpNotEqual {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ bool apply(A a, B b) { return a != b; }
+};
+struct OpLess {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ bool apply(A a, B b) { return a < b; }
+};
+struct OpLessEqual {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ bool apply(A a, B b) { return a <= b; }
+};
+struct OpGreater {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ bool apply(A a, B b) { return a > b; }
+};
+struct OpGreaterEqual {
+	template <typename A, typename B>
+	static _FORCE_INLINE_ bool apply(A a, B b) { return a >= b; }
+};
+
+template <typename A, typename B, typename Op>
+void _native_evaluate(const Variant *p_left, const Variant *p_right, Variant *r_ret) {
+	*r_ret = Op::apply(A(*p_left), B(*p_right));
+}
+
+template <typename Op>
+LimboUtility::OperatorEvaluator::Function _get_numeric_evaluator(Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+		return _native_evaluate<int64_t, int64_t, Op>;
+	} else if (p_left_type == Variant::INT && p_right_type == Variant::FLOAT) {
+		return _native_evaluate<int64_t, double, Op>;
+	} else if (p_left_type == Variant::FLOAT && p_right_type == Variant::INT) {
+		return _native_evaluate<double, int64_t, Op>;
+	} else if (p_left_type == Variant::FLOAT && p_right_type == Variant::FLOAT) {
+		return _native_evaluate<double, double, Op>;
+	}
+	return nullptr;
+}
+
+template <typename Op>
+LimboUtility::OperatorEvaluator::Function _get_equality_evaluator(Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type == Variant::BOOL && p_right_type == Variant::BOOL) {
+		return _native_evaluate<bool, bool, Op>;
+	}
+	return _get_numeric_evaluator<Op>(p_left_type, p_right_type);
+}
+
+LimboUtility::OperatorEvaluator _make_evaluator(Variant::Operator p_op, Variant::Type p_left_type, Variant::Type p_right_type) {
+	LimboUtility::OperatorEvaluator evaluator;
+	evaluator.left_type = p_left_type;
+	evaluator.right_type = p_right_type;
+
+	// * Untyped variables and objects are always evaluated at runtime.
+	if (p_left_type == Variant::NIL || p_right_type == Variant::NIL ||
+			p_left_type == Variant::OBJECT || p_right_type == Variant::OBJECT) {
+		return evaluator;
+	}
+
+	switch (p_op) {
+		case Variant::OP_ADD: {
+			evaluator.function = _get_numeric_evaluator<OpAdd>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_SUBTRACT: {
+			evaluator.function = _get_numeric_evaluator<OpSubtract>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_MULTIPLY: {
+			evaluator.function = _get_numeric_evaluator<OpMultiply>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_DIVIDE: {
+			// Integer division is left to Variant, which reports division by zero.
+			if (p_right_type == Variant::FLOAT) {
+				evaluator.function = _get_numeric_evaluator<OpDivide>(p_left_type, p_right_type);
+			}
+		} break;
+		case Variant::OP_EQUAL: {
+			evaluator.function = _get_equality_evaluator<OpEqual>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_NOT_EQUAL: {
+			evaluator.function = _get_equality_evaluator<OpNotEqual>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_LESS: {
+			evaluator.function = _get_numeric_evaluator<OpLess>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_LESS_EQUAL: {
+			evaluator.function = _get_numeric_evaluator<OpLessEqual>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_GREATER: {
+			evaluator.function = _get_numeric_evaluator<OpGreater>(p_left_type, p_right_type);
+		} break;
+		case Variant::OP_GREATER_EQUAL: {
+			evaluator.function = _get_numeric_evaluator<OpGreaterEqual>(p_left_type, p_right_type);
+		} break;
+		default: {
+		} break;
+	}
+
+#ifdef LIMBOAI_MODULE
+	// Other types use the engine's validated evaluators, except operators that report errors at runtime.
+	if (evaluator.function == nullptr && p_op != Variant::OP_DIVIDE && p_op != Variant::OP_MODULE &&
+			p_op != Variant::OP_SHIFT_LEFT && p_op != Variant::OP_SHIFT_RIGHT) {
+		evaluator.function = Variant::get_validated_operator_evaluator(p_op, p_left_type, p_right_type);
+		if (evaluator.function) {
+			evaluator.return_type = Variant::get_operator_return_type(p_op, p_left_type, p_right_type);
+		}
+	}
+#endif // LIMBOAI_MODULE
+
+	return evaluator;
+}
+
+_FORCE_INLINE_ void _evaluate(const LimboUtility::OperatorEvaluator &p_evaluator, const Variant &p_left, const Variant &p_right, Variant &r_ret) {
+#ifdef LIMBOAI_MODULE
+	VariantInternal::initialize(&r_ret, p_evaluator.return_type);
+#endif
+	p_evaluator.function(&p_left, &p_right, &r_ret);
+}
+
+} //namespace
+
 LimboUtility *LimboUtility::get_singleton() {
 	return singleton;
 }
@@ -291,6 +436,85 @@ Variant LimboUtility::perform_operation(Operation p_operation, const Variant &le
 	return ret;
 }
 
+LimboUtility::OperatorEvaluator LimboUtility::get_check_evaluator(CheckType p_check_type, Variant::Type p_left_type, Variant::Type p_right_type) const {
+	switch (p_check_type) {
+		case CHECK_EQUAL: {
+			return _make_evaluator(Variant::OP_EQUAL, p_left_type, p_right_type);
+		} break;
+		case CHECK_LESS_THAN: {
+			return _make_evaluator(Variant::OP_LESS, p_left_type, p_right_type);
+		} break;
+		case CHECK_LESS_THAN_OR_EQUAL: {
+			return _make_evaluator(Variant::OP_LESS_EQUAL, p_left_type, p_right_type);
+		} break;
+		case CHECK_GREATER_THAN: {
+			return _make_evaluator(Variant::OP_GREATER, p_left_type, p_right_type);
+		} break;
+		case CHECK_GREATER_THAN_OR_EQUAL: {
+			return _make_evaluator(Variant::OP_GREATER_EQUAL, p_left_type, p_right_type);
+		} break;
+		case CHECK_NOT_EQUAL: {
+			return _make_evaluator(Variant::OP_NOT_EQUAL, p_left_type, p_right_type);
+		} break;
+		default: {
+			return OperatorEvaluator();
+		} break;
+	}
+}
+
+LimboUtility::OperatorEvaluator LimboUtility::get_operation_evaluator(Operation p_operation, Variant::Type p_left_type, Variant::Type p_right_type) const {
+	switch (p_operation) {
+		case OPERATION_ADDITION: {
+			return _make_evaluator(Variant::OP_ADD, p_left_type, p_right_type);
+		} break;
+		case OPERATION_SUBTRACTION: {
+			return _make_evaluator(Variant::OP_SUBTRACT, p_left_type, p_right_type);
+		} break;
+		case OPERATION_MULTIPLICATION: {
+			return _make_evaluator(Variant::OP_MULTIPLY, p_left_type, p_right_type);
+		} break;
+		case OPERATION_DIVISION: {
+			return _make_evaluator(Variant::OP_DIVIDE, p_left_type, p_right_type);
+		} break;
+#ifdef LIMBOAI_MODULE
+		case OPERATION_POWER: {
+			return _make_evaluator(Variant::OP_POWER, p_left_type, p_right_type);
+		} break;
+#endif // LIMBOAI_MODULE
+		case OPERATION_BIT_AND: {
+			return _make_evaluator(Variant::OP_BIT_AND, p_left_type, p_right_type);
+		} break;
+		case OPERATION_BIT_OR: {
+			return _make_evaluator(Variant::OP_BIT_OR, p_left_type, p_right_type);
+		} break;
+		case OPERATION_BIT_XOR: {
+			return _make_evaluator(Variant::OP_BIT_XOR, p_left_type, p_right_type);
+		} break;
+		default: {
+			// Modulo and shifts report errors at runtime, so they are always evaluated by Variant.
+			return OperatorEvaluator();
+		} break;
+	}
+}
+
+bool LimboUtility::perform_check_with_evaluator(CheckType p_check_type, const OperatorEvaluator &p_evaluator, const Variant &left_value, const Variant &right_value) {
+	if (likely(p_evaluator.is_applicable(left_value, right_value))) {
+		Variant ret;
+		_evaluate(p_evaluator, left_value, right_value, ret);
+		return ret;
+	}
+	return perform_check(p_check_type, left_value, right_value);
+}
+
+Variant LimboUtility::perform_operation_with_evaluator(Operation p_operation, const OperatorEvaluator &p_evaluator, const Variant &left_value, const Variant &right_value) {
+	if (likely(p_evaluator.is_applicable(left_value, right_value))) {
+		Variant ret;
+		_evaluate(p_evaluator, left_value, right_value, ret);
+		return ret;
+	}
+	return perform_operation(p_operation, left_value, right_value);
+}
+
 String LimboUtility::get_property_hint_text(PropertyHint p_hint) const {
 	switch (p_hint) {
 		case PROPERTY_HINT_NONE: {
@@ -65,6 +65,21 @@ public:
 		OPERATION_BIT_XOR,
 	};
 
+	// Check or operation resolved ahead of time for specific operand types.
+	// Used only when both operands have the expected types; see perform_check_with_evaluator().
+	struct OperatorEvaluator {
+		typedef void (*Function)(const Variant *p_left, const Variant *p_right, Variant *r_ret);
+
+		Function function = nullptr;
+		Variant::Type left_type = Variant::NIL;
+		Variant::Type right_type = Variant::NIL;
+		Variant::Type return_type = Variant::NIL;
+
+		_FORCE_INLINE_ bool is_applicable(const Variant &p_left, const Variant &p_right) const {
+			return function != nullptr && p_left.get_type() == left_type && p_right.get_type() == right_type;
+		}
+	};
+
 protected:
 	static LimboUtility *singleton;
 	static void _bind_methods();
@@ -83,6 +98,11 @@ public:
 	String get_operation_string(Operation p_operation) const;
 	Variant perform_operation(Operation p_operation, const Variant &left_value, const Variant &right_value);
 
+	OperatorEvaluator get_check_evaluator(CheckType p_check_type, Variant::Type p_left_type, Variant::Type p_right_type) const;
+	OperatorEvaluator get_operation_evaluator(Operation p_operation, Variant::Type p_left_type, Variant::Type p_right_type) const;
+	bool perform_check_with_evaluator(CheckType p_check_type, const OperatorEvaluator &p_evaluator, const Variant &left_value, const Variant &right_value);
+	Variant perform_operation_with_evaluator(Operation p_operation, const OperatorEvaluator &p_evaluator, const Variant &left_value, const Variant &right_value);
+
 	String get_property_hint_text(PropertyHint p_hint) const;
 	PackedInt32Array get_property_hints_allowed_for_type(Variant::Type p_type) const;
 